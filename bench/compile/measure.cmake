@@ -0,0 +1,65 @@
+# Compiles each generated translation unit, and records its compile time (and peak memory, when GNU time is available).
+# Invoked by the NamedTypeCompileBench target, see CMakeLists.txt.
+
+cmake_minimum_required(VERSION 3.23) # for microseconds in string(TIMESTAMP)
+
+function(now_in_microseconds result)
+    string(TIMESTAMP seconds "%s" UTC)
+    string(TIMESTAMP microseconds "%f" UTC)
+    math(EXPR value "${seconds} * 1000000 + ${microseconds}")
+    set(${result} ${value} PARENT_SCOPE)
+endfunction()
+
+set(results "")
+foreach(source ${SOURCES})
+    get_filename_component(name "${source}" NAME_WE)
+    string(REPLACE "compile_bench_" "" pack "${name}")
+
+    if(COMPILER_ID STREQUAL "MSVC")
+        set(command "${COMPILER}" ${STANDARD_FLAG} ${TIME_REPORT_FLAG} /nologo /O2 "/I${INCLUDE_DIR}" /c "${source}" "/Fo${name}.obj")
+    else()
+        set(command "${COMPILER}" ${STANDARD_FLAG} ${TIME_REPORT_FLAG} -O2 "-I${INCLUDE_DIR}" -c "${source}" -o "${name}.o")
+    endif()
+    set(memoryFile "${name}.memory.txt")
+    if(GNU_TIME)
+        set(command "${GNU_TIME}" -f "%M" -o "${memoryFile}" ${command})
+    endif()
+
+    now_in_microseconds(start)
+    execute_process(COMMAND ${command}
+                    RESULT_VARIABLE status
+                    OUTPUT_FILE "${name}.report.txt"
+                    ERROR_FILE "${name}.report.txt")
+    now_in_microseconds(end)
+    if(NOT status EQUAL 0)
+        message(FATAL_ERROR "Compiling ${source} failed, see ${name}.report.txt")
+    endif()
+
+    math(EXPR milliseconds "(${end} - ${start}) / 1000")
+    set(line "${pack} ${milliseconds} ms")
+    if(GNU_TIME AND EXISTS "${memoryFile}")
+        file(READ "${memoryFile}" kilobytes)
+        string(STRIP "${kilobytes}" kilobytes)
+        string(APPEND line " ${kilobytes} kB")
+    endif()
+    message(STATUS "${line}")
+    string(APPEND results "${line}\n")
+
+    if(BASELINE)
+        file(STRINGS "${BASELINE}" baselineLines REGEX "^${pack} ")
+        if(baselineLines)
+            string(REGEX REPLACE "^${pack} ([0-9]+) ms.*" "\\1" baselineMilliseconds "${baselineLines}")
+            math(EXPR allowed "${baselineMilliseconds} * (100 + ${TOLERANCE}) / 100")
+            if(milliseconds GREATER allowed)
+                set(regressions "${regressions}${pack}: ${milliseconds} ms instead of ${baselineMilliseconds} ms\n")
+            endif()
+        endif()
+    endif()
+endforeach()
+
+file(WRITE "${RESULTS}" "${results}")
+message(STATUS "Compile times written to ${RESULTS}")
+
+if(regressions)
+    message(FATAL_ERROR "Compile time regressions:\n${regressions}")
+endif()
@@ -0,0 +1,245 @@
+#include "NamedType/named_type.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Each benchmark comes in two versions, one on the raw type and one on the strong type,
+// that should perform the same.
+
+namespace
+{
+
+using StrongInt = fluent::NamedType<uint64_t, struct StrongIntTag, fluent::Arithmetic>;
+using Meter = fluent::NamedType<double, struct MeterTag, fluent::Addable, fluent::Subtractable, fluent::Multiplicable>;
+using Key = fluent::NamedType<uint64_t, struct KeyTag, fluent::Comparable, fluent::Hashable>;
+using FirstName = fluent::NamedType<std::string, struct FirstNameTag>;
+using LastName = fluent::NamedType<std::string, struct LastNameTag>;
+
+std::vector<uint64_t> randomValues(std::size_t size)
+{
+    std::mt19937_64 engine(42);
+    std::vector<uint64_t> values(size);
+    std::generate(values.begin(), values.end(), [&engine]() { return engine() % 1000000; });
+    return values;
+}
+
+template <typename T>
+std::vector<T> wrap(std::vector<uint64_t> const& values)
+{
+    std::vector<T> result;
+    result.reserve(values.size());
+    for (auto value : values)
+    {
+        result.emplace_back(value);
+    }
+    return result;
+}
+
+constexpr std::size_t elements = 1 << 16;
+
+// Increments
+
+void rawIncrement(benchmark::State& state)
+{
+    uint64_t counter = 0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < elements; ++i)
+        {
+            ++counter;
+            benchmark::DoNotOptimize(counter);
+        }
+    }
+}
+BENCHMARK(rawIncrement);
+
+void strongIncrement(benchmark::State& state)
+{
+    StrongInt counter(0u);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < elements; ++i)
+        {
+            ++counter;
+            benchmark::DoNotOptimize(counter);
+        }
+    }
+}
+BENCHMARK(strongIncrement);
+
+// Arithmetic chains
+
+void rawArithmeticChain(benchmark::State& state)
+{
+    std::vector<double> values(elements, 1.5);
+    for (auto _ : state)
+    {
+        double total = 0;
+        for (auto value : values)
+        {
+            total = total + value * value - value;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+}
+BENCHMARK(rawArithmeticChain);
+
+void strongArithmeticChain(benchmark::State& state)
+{
+    std::vector<Meter> values(elements, Meter(1.5));
+    for (auto _ : state)
+    {
+        Meter total(0.0);
+        for (auto const& value : values)
+        {
+            total = total + value * value - value;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+}
+BENCHMARK(strongArithmeticChain);
+
+// Comparisons in std::sort
+
+void rawSort(benchmark::State& state)
+{
+    auto const values = randomValues(elements);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto sorted = values;
+        state.ResumeTiming();
+        std::sort(sorted.begin(), sorted.end());
+        benchmark::DoNotOptimize(sorted.data());
+    }
+}
+BENCHMARK(rawSort);
+
+void strongSort(benchmark::State& state)
+{
+    auto const values = wrap<Key>(randomValues(elements));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto sorted = values;
+        state.ResumeTiming();
+        std::sort(sorted.begin(), sorted.end());
+        benchmark::DoNotOptimize(sorted.data());
+    }
+}
+BENCHMARK(strongSort);
+
+// Hashing in std::unordered_map
+
+void rawHashMap(benchmark::State& state)
+{
+    auto const values = randomValues(elements);
+    for (auto _ : state)
+    {
+        std::unordered_map<uint64_t, uint64_t> map;
+        for (auto value : values)
+        {
+            ++map[value];
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+}
+BENCHMARK(rawHashMap);
+
+void strongHashMap(benchmark::State& state)
+{
+    auto const values = wrap<Key>(randomValues(elements));
+    for (auto _ : state)
+    {
+        std::unordered_map<Key, uint64_t> map;
+        for (auto const& value : values)
+        {
+            ++map[value];
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+}
+BENCHMARK(strongHashMap);
+
+// Conversion to NamedType::ref
+
+void addOne(uint64_t& value)
+{
+    ++value;
+}
+
+void addOneStrong(StrongInt::ref value)
+{
+    ++value.get();
+}
+
+void rawReference(benchmark::State& state)
+{
+    uint64_t value = 0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < elements; ++i)
+        {
+            addOne(value);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+}
+BENCHMARK(rawReference);
+
+void strongReference(benchmark::State& state)
+{
+    StrongInt value(0u);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < elements; ++i)
+        {
+            addOneStrong(value);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+}
+BENCHMARK(strongReference);
+
+// Named arguments
+
+std::size_t fullNameLength(std::string const& firstName, std::string const& lastName)
+{
+    return firstName.size() + lastName.size();
+}
+
+std::size_t strongFullNameLength(FirstName const& firstName, LastName const& lastName)
+{
+    return firstName.get().size() + lastName.get().size();
+}
+
+void rawArguments(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fullNameLength("James", "Bond"));
+    }
+}
+BENCHMARK(rawArguments);
+
+void strongNamedArguments(benchmark::State& state)
+{
+    static const FirstName::argument firstName;
+    static const LastName::argument lastName;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(strongFullNameLength(firstName = "James", lastName = "Bond"));
+    }
+}
+BENCHMARK(strongNamedArguments);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,128 @@
+#ifndef NAMED_TYPE_ATOMIC_NAMED_TYPE_HPP
+#define NAMED_TYPE_ATOMIC_NAMED_TYPE_HPP
+
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace fluent
+{
+
+// An atomic variable holding a NamedType<T, Parameter, Skills...>. Its operations take and return the
+// strong type, and forward to std::atomic<T>:
+//
+//     using SequenceNumber = NamedType<uint64_t, struct SequenceNumberTag, Addable, Comparable>;
+//     AtomicNamedType<uint64_t, struct SequenceNumberTag, Addable, Comparable> next{SequenceNumber(0)};
+//     SequenceNumber mine = next.fetch_add(SequenceNumber(1), std::memory_order_relaxed);
+//
+// fetch_add and fetch_sub are available if the strong type is addable or subtractable.
+template <typename T, typename Parameter, template <typename> class... Skills>
+class AtomicNamedType
+{
+    static_assert(!std::is_reference<T>::value, "an atomic strong type cannot hold a reference");
+    static_assert(std::is_trivially_copyable<T>::value, "std::atomic needs a trivially copyable type");
+
+public:
+    using value_type = NamedType<T, Parameter, Skills...>;
+    using UnderlyingType = T;
+
+    static constexpr bool is_always_lock_free = std::atomic<T>::is_always_lock_free;
+
+    constexpr AtomicNamedType() noexcept = default;
+    constexpr explicit AtomicNamedType(value_type const& value) noexcept : value_(value.get())
+    {
+    }
+
+    AtomicNamedType(AtomicNamedType const&) = delete;
+    AtomicNamedType& operator=(AtomicNamedType const&) = delete;
+
+    FLUENT_NODISCARD bool is_lock_free() const noexcept
+    {
+        return value_.is_lock_free();
+    }
+
+    FLUENT_NODISCARD value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return value_type(value_.load(order));
+    }
+
+    void store(value_type const& desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        value_.store(desired.get(), order);
+    }
+
+    value_type exchange(value_type const& desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return value_type(value_.exchange(desired.get(), order));
+    }
+
+    bool compare_exchange_weak(value_type& expected, value_type const& desired, std::memory_order success,
+                               std::memory_order failure) noexcept
+    {
+        return value_.compare_exchange_weak(expected.get(), desired.get(), success, failure);
+    }
+
+    bool compare_exchange_weak(value_type& expected, value_type const& desired,
+                               std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return value_.compare_exchange_weak(expected.get(), desired.get(), order);
+    }
+
+    bool compare_exchange_strong(value_type& expected, value_type const& desired, std::memory_order success,
+                                 std::memory_order failure) noexcept
+    {
+        return value_.compare_exchange_strong(expected.get(), desired.get(), success, failure);
+    }
+
+    bool compare_exchange_strong(value_type& expected, value_type const& desired,
+                                 std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return value_.compare_exchange_strong(expected.get(), desired.get(), order);
+    }
+
+    value_type fetch_add(value_type const& operand, std::memory_order order = std::memory_order_seq_cst) noexcept
+        requires HasSkill<value_type, BinaryAddable>
+    {
+        return value_type(value_.fetch_add(operand.get(), order));
+    }
+
+    value_type fetch_sub(value_type const& operand, std::memory_order order = std::memory_order_seq_cst) noexcept
+        requires HasSkill<value_type, BinarySubtractable>
+    {
+        return value_type(value_.fetch_sub(operand.get(), order));
+    }
+
+    void wait(value_type const& old, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        value_.wait(old.get(), order);
+    }
+
+    void notify_one() noexcept
+    {
+        value_.notify_one();
+    }
+
+    void notify_all() noexcept
+    {
+        value_.notify_all();
+    }
+
+private:
+    std::atomic<T> value_{};
+};
+
+// An AtomicNamedType that occupies its own cache lines, so that atomics updated by different threads,
+// such as per-core counters stored in an array, do not slow each other down by false sharing.
+template <typename T, typename Parameter, template <typename> class... Skills>
+class alignas(FLUENT_CACHE_LINE_SIZE) PaddedAtomicNamedType : public AtomicNamedType<T, Parameter, Skills...>
+{
+public:
+    using AtomicNamedType<T, Parameter, Skills...>::AtomicNamedType;
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,208 @@
+#ifndef NAMED_TYPE_BATCH_HPP
+#define NAMED_TYPE_BATCH_HPP
+
+#include "named_type_impl.hpp"
+#include "reduction.hpp"
+#include "span.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+// Element-wise operations over contiguous ranges of strong types (std::vector, std::array, std::span...).
+// The kernels run straight on the underlying values, as plain loops over arrays of the underlying type,
+// so that the compiler can vectorize them regardless of the inlining of the skills.
+// Each operation is available only if the strong type has the corresponding skill.
+// All the ranges passed to an operation must have the same size, which is checked with FLUENT_ASSERT.
+// The result may alias an operand.
+
+namespace fluent
+{
+namespace details
+{
+template <typename Range, template <typename> class Skill>
+concept BatchRange = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>
+                  && HasSkill<std::ranges::range_value_t<Range>, Skill>
+                  && UnderlyingLayoutCompatible<std::ranges::range_value_t<Range>>;
+
+// The two operands of a kernel must hold the same strong type, so that no Meter gets added to a Second.
+template <typename Left, typename Right, template <typename> class Skill>
+concept BatchOperands = BatchRange<Left, Skill> && BatchRange<Right, Skill>
+                     && std::is_same<std::ranges::range_value_t<Left>, std::ranges::range_value_t<Right>>::value;
+
+template <typename Range, typename NamedType_>
+concept BatchOutput = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>
+                   && std::is_same<std::ranges::range_value_t<Range>, NamedType_>::value
+                   && !std::is_const<std::remove_reference_t<std::ranges::range_reference_t<Range>>>::value;
+
+template <typename Left, typename Right, typename Result, typename Operation>
+void transform(Left const& left, Right const& right, Result&& result, Operation operation)
+{
+    auto const leftData = as_underlying_span(left);
+    auto const rightData = as_underlying_span(right);
+    auto const resultData = as_underlying_span(result);
+    auto const size = std::ranges::size(left);
+    FLUENT_ASSERT(std::ranges::size(right) == size && std::ranges::size(result) == size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        resultData[i] = operation(leftData[i], rightData[i]);
+    }
+}
+} // namespace details
+
+namespace batch
+{
+
+template <typename Left, typename Right, typename Result>
+    requires details::BatchOperands<Left, Right, BinaryAddable>
+          && details::BatchOutput<Result, std::ranges::range_value_t<Left>>
+void add(Left const& left, Right const& right, Result&& result)
+{
+    details::transform(left, right, result, [](auto const& l, auto const& r) { return l + r; });
+}
+
+template <typename Left, typename Right, typename Result>
+    requires details::BatchOperands<Left, Right, BinarySubtractable>
+          && details::BatchOutput<Result, std::ranges::range_value_t<Left>>
+void subtract(Left const& left, Right const& right, Result&& result)
+{
+    details::transform(left, right, result, [](auto const& l, auto const& r) { return l - r; });
+}
+
+template <typename Left, typename Right, typename Result>
+    requires details::BatchOperands<Left, Right, Multiplicable>
+          && details::BatchOutput<Result, std::ranges::range_value_t<Left>>
+void multiply(Left const& left, Right const& right, Result&& result)
+{
+    details::transform(left, right, result, [](auto const& l, auto const& r) { return l * r; });
+}
+
+template <typename Left, typename Right, typename Result>
+    requires details::BatchOperands<Left, Right, Comparable>
+          && details::BatchOutput<Result, std::ranges::range_value_t<Left>>
+void min(Left const& left, Right const& right, Result&& result)
+{
+    details::transform(left, right, result, [](auto const& l, auto const& r) { return r < l ? r : l; });
+}
+
+template <typename Left, typename Right, typename Result>
+    requires details::BatchOperands<Left, Right, Comparable>
+          && details::BatchOutput<Result, std::ranges::range_value_t<Left>>
+void max(Left const& left, Right const& right, Result&& result)
+{
+    details::transform(left, right, result, [](auto const& l, auto const& r) { return l < r ? r : l; });
+}
+
+template <typename Left, typename Right, typename Result>
+    requires details::BatchOperands<Left, Right, BitWiseAndable>
+          && details::BatchOutput<Result, std::ranges::range_value_t<Left>>
+void bit_and(Left const& left, Right const& right, Result&& result)
+{
+    details::transform(left, right, result, [](auto const& l, auto const& r) { return l & r; });
+}
+
+template <typename Left, typename Right, typename Result>
+    requires details::BatchOperands<Left, Right, BitWiseOrable>
+          && details::BatchOutput<Result, std::ranges::range_value_t<Left>>
+void bit_or(Left const& left, Right const& right, Result&& result)
+{
+    details::transform(left, right, result, [](auto const& l, auto const& r) { return l | r; });
+}
+
+template <typename Left, typename Right, typename Result>
+    requires details::BatchOperands<Left, Right, BitWiseXorable>
+          && details::BatchOutput<Result, std::ranges::range_value_t<Left>>
+void bit_xor(Left const& left, Right const& right, Result&& result)
+{
+    details::transform(left, right, result, [](auto const& l, auto const& r) { return l ^ r; });
+}
+
+template <typename Left, typename Right, typename Result>
+    requires details::BatchOperands<Left, Right, SaturatingAddable>
+          && details::BatchOutput<Result, std::ranges::range_value_t<Left>>
+void saturating_add(Left const& left, Right const& right, Result&& result)
+{
+    details::transform(left, right, result, [](auto l, auto r) noexcept { return details::saturatingAdd(l, r); });
+}
+
+template <typename Left, typename Right, typename Result>
+    requires details::BatchOperands<Left, Right, SaturatingSubtractable>
+          && details::BatchOutput<Result, std::ranges::range_value_t<Left>>
+void saturating_subtract(Left const& left, Right const& right, Result&& result)
+{
+    details::transform(left, right, result, [](auto l, auto r) noexcept { return details::saturatingSubtract(l, r); });
+}
+
+#if FLUENT_HOSTED == 1
+// Throws std::overflow_error if any of the products overflows, after the whole loop has run without branching.
+// The result is then unspecified.
+template <typename Left, typename Right, typename Result>
+    requires details::BatchOperands<Left, Right, CheckedMultiplicable>
+          && details::BatchOutput<Result, std::ranges::range_value_t<Left>>
+void checked_multiply(Left const& left, Right const& right, Result&& result)
+{
+    bool overflow = false;
+    details::transform(left, right, result, [&overflow](auto l, auto r) noexcept {
+        auto product = decltype(l){};
+        overflow |= details::multiplyOverflows(l, r, product);
+        return product;
+    });
+    if (overflow)
+    {
+        throw std::overflow_error("overflow in the multiplication of a strong type");
+    }
+}
+#endif
+
+// Writes left[i] < right[i] into mask[i].
+template <typename Left, typename Right>
+    requires details::BatchOperands<Left, Right, Comparable>
+void less(Left const& left, Right const& right, std::span<bool> mask)
+{
+    auto const leftData = as_underlying_span(left);
+    auto const rightData = as_underlying_span(right);
+    auto const size = std::ranges::size(left);
+    FLUENT_ASSERT(std::ranges::size(right) == size && mask.size() == size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        mask[i] = leftData[i] < rightData[i];
+    }
+}
+
+// Writes left[i] == right[i] into mask[i].
+template <typename Left, typename Right>
+    requires details::BatchOperands<Left, Right, Comparable>
+void equal(Left const& left, Right const& right, std::span<bool> mask)
+{
+    auto const leftData = as_underlying_span(left);
+    auto const rightData = as_underlying_span(right);
+    auto const size = std::ranges::size(left);
+    FLUENT_ASSERT(std::ranges::size(right) == size && mask.size() == size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        mask[i] = leftData[i] == rightData[i];
+    }
+}
+
+// The sequential versions of par::sum and par::product, that start from the same identity elements.
+template <typename Range>
+    requires details::BatchRange<Range, BinaryAddable>
+FLUENT_NODISCARD std::ranges::range_value_t<Range> sum(Range const& range)
+{
+    return details::reduce(range, std::plus<>());
+}
+
+template <typename Range>
+    requires details::BatchRange<Range, Multiplicable>
+FLUENT_NODISCARD std::ranges::range_value_t<Range> product(Range const& range)
+{
+    return details::reduce(range, std::multiplies<>());
+}
+
+} // namespace batch
+} // namespace fluent
+
+#endif
@@ -0,0 +1,234 @@
+#ifndef NAMED_TYPE_CHRONO_HPP
+#define NAMED_TYPE_CHRONO_HPP
+
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <chrono>
+#include <compare>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#    define FLUENT_HAS_RDTSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#    include <x86intrin.h>
+#    define FLUENT_HAS_RDTSC 1
+#else
+#    define FLUENT_HAS_RDTSC 0
+#endif
+
+// Strong types over std::chrono durations, and timing of the hot paths with them:
+//
+//     using Latency = strong_duration<struct LatencyTag, std::chrono::nanoseconds>;
+//     stopwatch<struct LatencyTag> watch;
+//     ...
+//     Latency latency = watch.elapsed();
+//
+// Strong durations with the same tag and different periods can be compared and added to each other like
+// std::chrono durations, and converted into each other with fluent::duration_cast.
+
+namespace fluent
+{
+
+template <typename Tag, typename Duration>
+using strong_duration = NamedType<Duration, Tag, Addable, Subtractable, Comparable, ScalableBy<typename Duration::rep>::template templ>;
+
+namespace details
+{
+template <typename T>
+struct is_chrono_duration : std::false_type
+{
+};
+
+template <typename Rep, typename Period>
+struct is_chrono_duration<std::chrono::duration<Rep, Period>> : std::true_type
+{
+};
+
+template <typename T>
+struct duration_traits
+{
+    static constexpr bool is_strong_duration = false;
+};
+
+template <typename Duration, typename Tag, template <typename> class... Skills>
+struct duration_traits<NamedType<Duration, Tag, Skills...>>
+{
+    static constexpr bool is_strong_duration = is_chrono_duration<Duration>::value;
+    using tag = Tag;
+    template <typename OtherDuration>
+    using rebind = NamedType<OtherDuration, Tag, Skills...>;
+};
+
+// Two strong types over durations of different periods, that measure the same thing.
+template <typename Left, typename Right>
+concept SameTagDurations = duration_traits<Left>::is_strong_duration && duration_traits<Right>::is_strong_duration
+                        && std::is_same<typename duration_traits<Left>::tag, typename duration_traits<Right>::tag>::value
+                        && !std::is_same<Left, Right>::value;
+
+template <typename Left, typename Right>
+using common_strong_duration = typename duration_traits<Left>::template rebind<
+    std::common_type_t<typename Left::UnderlyingType, typename Right::UnderlyingType>>;
+} // namespace details
+
+// Converts a strong duration into one with the same tag and another period, like std::chrono::duration_cast.
+template <typename To, typename From>
+    requires details::duration_traits<To>::is_strong_duration && details::duration_traits<From>::is_strong_duration
+          && std::is_same<typename details::duration_traits<To>::tag, typename details::duration_traits<From>::tag>::value
+FLUENT_NODISCARD constexpr To duration_cast(From const& duration)
+{
+    return To(std::chrono::duration_cast<typename To::UnderlyingType>(duration.get()));
+}
+
+template <typename Left, typename Right>
+    requires details::SameTagDurations<Left, Right>
+FLUENT_NODISCARD constexpr auto operator+(Left const& left, Right const& right)
+{
+    return details::common_strong_duration<Left, Right>(left.get() + right.get());
+}
+
+template <typename Left, typename Right>
+    requires details::SameTagDurations<Left, Right>
+FLUENT_NODISCARD constexpr auto operator-(Left const& left, Right const& right)
+{
+    return details::common_strong_duration<Left, Right>(left.get() - right.get());
+}
+
+template <typename Left, typename Right>
+    requires details::SameTagDurations<Left, Right>
+FLUENT_NODISCARD constexpr bool operator==(Left const& left, Right const& right)
+{
+    return left.get() == right.get();
+}
+
+template <typename Left, typename Right>
+    requires details::SameTagDurations<Left, Right>
+FLUENT_NODISCARD constexpr auto operator<=>(Left const& left, Right const& right)
+{
+    return left.get() <=> right.get();
+}
+
+// Time stamp counter of the processor, where available. Otherwise the nanoseconds of std::chrono::steady_clock.
+using tsc_ticks = NamedType<std::uint64_t, struct TscTicksTag, Addable, Subtractable, Comparable>;
+
+FLUENT_NODISCARD inline tsc_ticks read_tsc() noexcept
+{
+#if FLUENT_HAS_RDTSC
+    return tsc_ticks(__rdtsc());
+#else
+    auto const now = std::chrono::steady_clock::now().time_since_epoch();
+    return tsc_ticks(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()));
+#endif
+}
+
+namespace details
+{
+// value * factor / 2^32 rounded to the nearest, without overflowing for the products that do not fit in 64 bits.
+FLUENT_NODISCARD constexpr std::uint64_t multiplyShift32(std::uint64_t value, std::uint64_t factor) noexcept
+{
+    constexpr auto half = std::uint64_t(1) << 31;
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 UInt128;
+    return static_cast<std::uint64_t>((static_cast<UInt128>(value) * factor + half) >> 32);
+#else
+    auto const valueHigh = value >> 32;
+    auto const valueLow = value & 0xFFFFFFFFu;
+    auto const factorHigh = factor >> 32;
+    auto const factorLow = factor & 0xFFFFFFFFu;
+    return ((valueHigh * factorHigh) << 32) + valueHigh * factorLow + valueLow * factorHigh + ((valueLow * factorLow + half) >> 32);
+#endif
+}
+} // namespace details
+
+// Converts ticks of the time stamp counter into nanoseconds, with a multiplication by a fixed-point factor.
+// Built from a constant frequency, the factor is computed at compile time:
+//
+//     constexpr auto tsc = tsc_conversion(2'900'000'000); // calibrated beforehand with tsc_conversion::calibrate()
+//     std::chrono::nanoseconds elapsed = tsc.to_nanoseconds(read_tsc() - start);
+class tsc_conversion
+{
+public:
+    constexpr explicit tsc_conversion(std::uint64_t ticksPerSecond)
+        : ticksPerSecond_(ticksPerSecond), nanosecondsPerTickFactor_(factorOf(ticksPerSecond))
+    {
+    }
+
+    // Measures the frequency of the time stamp counter against std::chrono::steady_clock, during interval.
+    static tsc_conversion calibrate(std::chrono::nanoseconds interval = std::chrono::milliseconds(10))
+    {
+        auto const startTime = std::chrono::steady_clock::now();
+        auto const startTicks = read_tsc();
+        auto endTime = startTime;
+        while (endTime - startTime < interval)
+        {
+            endTime = std::chrono::steady_clock::now();
+        }
+        auto const ticks = (read_tsc() - startTicks).get();
+        auto const nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+        return tsc_conversion(static_cast<std::uint64_t>(static_cast<double>(ticks) * 1e9 / static_cast<double>(nanoseconds)));
+    }
+
+    FLUENT_NODISCARD constexpr std::uint64_t ticks_per_second() const noexcept
+    {
+        return ticksPerSecond_;
+    }
+
+    FLUENT_NODISCARD constexpr std::chrono::nanoseconds to_nanoseconds(tsc_ticks ticks) const noexcept
+    {
+        return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(details::multiplyShift32(ticks.get(), nanosecondsPerTickFactor_)));
+    }
+
+private:
+    static constexpr std::uint64_t factorOf(std::uint64_t ticksPerSecond)
+    {
+        if (ticksPerSecond == 0)
+        {
+            throw std::invalid_argument("the frequency of the time stamp counter must not be zero");
+        }
+        return ((std::uint64_t(1'000'000'000) << 32) + ticksPerSecond / 2) / ticksPerSecond;
+    }
+
+    std::uint64_t ticksPerSecond_;
+    std::uint64_t nanosecondsPerTickFactor_;
+};
+
+// Measures the time elapsed since its construction or its last lap, as strong durations with the tag Tag.
+template <typename Tag, typename Clock = std::chrono::steady_clock>
+class stopwatch
+{
+public:
+    using duration = strong_duration<Tag, typename Clock::duration>;
+
+    stopwatch() noexcept(noexcept(Clock::now())) : start_(Clock::now())
+    {
+    }
+
+    FLUENT_NODISCARD duration elapsed() const noexcept(noexcept(Clock::now()))
+    {
+        return duration(Clock::now() - start_);
+    }
+
+    // Returns the time elapsed, and starts measuring again from now.
+    duration lap() noexcept(noexcept(Clock::now()))
+    {
+        auto const now = Clock::now();
+        auto const elapsedTime = duration(now - start_);
+        start_ = now;
+        return elapsedTime;
+    }
+
+    void restart() noexcept(noexcept(Clock::now()))
+    {
+        start_ = Clock::now();
+    }
+
+private:
+    typename Clock::time_point start_;
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,303 @@
+#ifndef NAMED_TYPE_CONCURRENT_QUEUE_HPP
+#define NAMED_TYPE_CONCURRENT_QUEUE_HPP
+
+#include "named_type_impl.hpp"
+#include "span.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+// Bounded queues that pass strong types between threads, storing their underlying values:
+//
+//     using Timestamp = NamedType<uint64_t, struct TimestampTag>;
+//     spsc_ring<Timestamp> ring(1024);
+//     ring.try_push(Timestamp(now));          // on the producer thread
+//     auto timestamp = ring.try_pop();        // on the consumer thread, a std::optional<Timestamp>
+//
+// The underlying type must be trivially copyable, and the strong type have its layout, so that batches
+// of values are copied with std::memcpy. The capacity must be a power of two. The indices written by
+// the different threads are on different cache lines.
+
+namespace fluent
+{
+
+namespace details
+{
+template <typename NamedType_>
+concept TriviallyQueueable = UnderlyingLayoutCompatible<NamedType_> && std::is_trivially_copyable<typename NamedType_::UnderlyingType>::value;
+
+inline std::size_t checkedQueueCapacity(std::size_t capacity)
+{
+    if (!std::has_single_bit(capacity))
+    {
+        throw std::invalid_argument("the capacity of a fluent queue must be a power of two");
+    }
+    return capacity;
+}
+} // namespace details
+
+// A queue with one producer thread and one consumer thread. Its operations are wait-free.
+template <typename NamedType_>
+    requires details::TriviallyQueueable<NamedType_>
+class spsc_ring
+{
+public:
+    using value_type = NamedType_;
+    using UnderlyingType = typename NamedType_::UnderlyingType;
+
+    explicit spsc_ring(std::size_t capacity)
+        : mask_(details::checkedQueueCapacity(capacity) - 1), values_(std::make_unique_for_overwrite<UnderlyingType[]>(capacity))
+    {
+    }
+
+    spsc_ring(spsc_ring const&) = delete;
+    spsc_ring& operator=(spsc_ring const&) = delete;
+
+    FLUENT_NODISCARD std::size_t capacity() const noexcept
+    {
+        return mask_ + 1;
+    }
+
+    // Only exact when neither thread is using the ring.
+    FLUENT_NODISCARD std::size_t size() const noexcept
+    {
+        auto const head = consumer_.head.load(std::memory_order_acquire);
+        return producer_.tail.load(std::memory_order_acquire) - head;
+    }
+
+    FLUENT_NODISCARD bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    // Producer side. Returns false if the ring is full.
+    bool try_push(value_type const& value) noexcept
+    {
+        return push(std::span<value_type const>(&value, 1)) == 1;
+    }
+
+    // Producer side. Pushes as many of the values as fit, and returns their number.
+    std::size_t push(std::span<value_type const> values) noexcept
+    {
+        auto const tail = producer_.tail.load(std::memory_order_relaxed);
+        if (capacity() - (tail - producer_.cachedHead) < values.size())
+        {
+            producer_.cachedHead = consumer_.head.load(std::memory_order_acquire);
+        }
+        auto const count = std::min(values.size(), capacity() - (tail - producer_.cachedHead));
+        if (count == 0)
+        {
+            return 0;
+        }
+        copyIn(tail, as_underlying_span(values).data(), count);
+        producer_.tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Consumer side. Returns an empty optional if the ring is empty.
+    FLUENT_NODISCARD std::optional<value_type> try_pop() noexcept
+    {
+        auto value = UnderlyingType();
+        if (popInto(&value, 1) == 0)
+        {
+            return std::nullopt;
+        }
+        return value_type(value);
+    }
+
+    // Consumer side. Pops as many values as are available and fit in values, and returns their number.
+    std::size_t pop(std::span<value_type> values) noexcept
+    {
+        return popInto(as_underlying_span(values).data(), values.size());
+    }
+
+private:
+    void copyIn(std::size_t index, UnderlyingType const* source, std::size_t count) noexcept
+    {
+        auto const position = index & mask_;
+        auto const first = std::min(count, capacity() - position);
+        std::memcpy(values_.get() + position, source, first * sizeof(UnderlyingType));
+        std::memcpy(values_.get(), source + first, (count - first) * sizeof(UnderlyingType));
+    }
+
+    std::size_t popInto(UnderlyingType* destination, std::size_t maxCount) noexcept
+    {
+        auto const head = consumer_.head.load(std::memory_order_relaxed);
+        if (consumer_.cachedTail - head < maxCount)
+        {
+            consumer_.cachedTail = producer_.tail.load(std::memory_order_acquire);
+        }
+        auto const count = std::min(maxCount, consumer_.cachedTail - head);
+        if (count == 0)
+        {
+            return 0;
+        }
+        auto const position = head & mask_;
+        auto const first = std::min(count, capacity() - position);
+        std::memcpy(destination, values_.get() + position, first * sizeof(UnderlyingType));
+        std::memcpy(destination + first, values_.get(), (count - first) * sizeof(UnderlyingType));
+        consumer_.head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    // The indices only increase, and are reduced modulo the capacity to address the values.
+    // Each thread keeps a copy of the index of the other, and reloads it only when it seems to be short of room.
+    struct alignas(FLUENT_CACHE_LINE_SIZE) Producer
+    {
+        std::atomic<std::size_t> tail{0};
+        std::size_t cachedHead = 0;
+    };
+    struct alignas(FLUENT_CACHE_LINE_SIZE) Consumer
+    {
+        std::atomic<std::size_t> head{0};
+        std::size_t cachedTail = 0;
+    };
+
+    std::size_t mask_;
+    std::unique_ptr<UnderlyingType[]> values_;
+    Producer producer_{};
+    Consumer consumer_{};
+};
+
+// A queue with any number of producer and consumer threads. Its operations are lock-free:
+// each value has a sequence number, that tells the threads whether its slot is free or filled.
+template <typename NamedType_>
+    requires details::TriviallyQueueable<NamedType_>
+class mpmc_queue
+{
+public:
+    using value_type = NamedType_;
+    using UnderlyingType = typename NamedType_::UnderlyingType;
+
+    explicit mpmc_queue(std::size_t capacity)
+        : mask_(details::checkedQueueCapacity(capacity) - 1), slots_(std::make_unique<Slot[]>(capacity))
+    {
+        for (std::size_t i = 0; i < capacity; ++i)
+        {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mpmc_queue(mpmc_queue const&) = delete;
+    mpmc_queue& operator=(mpmc_queue const&) = delete;
+
+    FLUENT_NODISCARD std::size_t capacity() const noexcept
+    {
+        return mask_ + 1;
+    }
+
+    // Returns false if the queue is full.
+    bool try_push(value_type const& value) noexcept
+    {
+        auto position = enqueue_.position.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            auto& slot = slots_[position & mask_];
+            auto const sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == position)
+            {
+                if (enqueue_.position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.value = value.get();
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (sequence < position)
+            {
+                return false;
+            }
+            else
+            {
+                position = enqueue_.position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Returns an empty optional if the queue is empty.
+    FLUENT_NODISCARD std::optional<value_type> try_pop() noexcept
+    {
+        auto position = dequeue_.position.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            auto& slot = slots_[position & mask_];
+            auto const sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == position + 1)
+            {
+                if (dequeue_.position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    auto const value = value_type(slot.value);
+                    slot.sequence.store(position + capacity(), std::memory_order_release);
+                    return value;
+                }
+            }
+            else if (sequence < position + 1)
+            {
+                return std::nullopt;
+            }
+            else
+            {
+                position = dequeue_.position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Pushes the values in order until the queue is full, and returns the number pushed.
+    std::size_t push(std::span<value_type const> values) noexcept
+    {
+        std::size_t count = 0;
+        while (count < values.size() && try_push(values[count]))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    // Pops values until the queue is empty or values is full, and returns the number popped.
+    std::size_t pop(std::span<value_type> values) noexcept
+    {
+        std::size_t count = 0;
+        for (; count < values.size(); ++count)
+        {
+            auto value = try_pop();
+            if (!value)
+            {
+                break;
+            }
+            values[count] = *value;
+        }
+        return count;
+    }
+
+private:
+    // The sequence of a slot is its position while it is free for this round of the producers,
+    // and its position + 1 once it is filled for this round of the consumers. Each slot has its own
+    // cache lines, so that the threads working on neighbouring slots do not contend for them.
+    struct alignas(FLUENT_CACHE_LINE_SIZE) Slot
+    {
+        std::atomic<std::size_t> sequence{0};
+        UnderlyingType value{};
+    };
+
+    struct alignas(FLUENT_CACHE_LINE_SIZE) Position
+    {
+        std::atomic<std::size_t> position{0};
+    };
+
+    std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+    Position enqueue_{};
+    Position dequeue_{};
+};
+
+} // namespace fluent
+
+#endif
@@ -1,17 +1,19 @@
 #ifndef CRTP_HPP
 #define CRTP_HPP
 
+#include "named_type_impl.hpp"
+
 namespace fluent
 {
 
 template <typename T, template <typename> class crtpType>
 struct crtp
 {
-    constexpr T& underlying()
+    FLUENT_ALWAYS_INLINE constexpr T& underlying()
     {
         return static_cast<T&>(*this);
     }
-    constexpr T const& underlying() const
+    FLUENT_ALWAYS_INLINE constexpr T const& underlying() const
     {
         return static_cast<T const&>(*this);
     }
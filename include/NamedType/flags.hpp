@@ -0,0 +1,317 @@
+#ifndef NAMED_TYPE_FLAGS_HPP
+#define NAMED_TYPE_FLAGS_HPP
+
+#include "named_type_impl.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace fluent
+{
+
+// The number of flags of the enumeration Enum, that is its enumerator count by default.
+// It can be specialized for enumerations that have no such enumerator.
+template <typename Enum>
+struct flag_count : std::integral_constant<std::size_t, static_cast<std::size_t>(Enum::count)>
+{
+};
+
+// A set of the values of the enumeration Enum, stored as a bit per value in as many 64-bit words as needed:
+//
+//     enum class Permission { read, write, execute, count };
+//     using Permissions = NamedType<flags<Permission>, struct PermissionsTag, BitWiseAndable, BitWiseOrable, MethodCallable>;
+//     Permissions granted(flags<Permission>{Permission::read, Permission::write});
+//     if (granted->includes(required.get())) ...
+//     for (Permission permission : granted.get()) ...
+//
+// The operations work a word at a time, and the iteration goes from one set bit to the next with std::countr_zero.
+template <typename Enum, std::size_t Size = flag_count<Enum>::value>
+class flags
+{
+    static_assert(std::is_enum<Enum>::value, "the values of fluent::flags are those of an enumeration");
+    static_assert(Size > 0, "fluent::flags must have at least one flag");
+
+public:
+    using word_type = std::uint64_t;
+    static constexpr std::size_t bits_per_word = 64;
+    static constexpr std::size_t word_count = (Size + bits_per_word - 1) / bits_per_word;
+
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Enum;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Enum;
+
+        constexpr iterator() noexcept = default;
+
+        FLUENT_NODISCARD constexpr Enum operator*() const noexcept
+        {
+            return static_cast<Enum>(word_ * bits_per_word + static_cast<std::size_t>(std::countr_zero(remaining_)));
+        }
+
+        constexpr iterator& operator++() noexcept
+        {
+            remaining_ &= remaining_ - 1;
+            skipEmptyWords();
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept
+        {
+            auto const previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        FLUENT_NODISCARD friend constexpr bool operator==(iterator const& left, iterator const& right) noexcept
+        {
+            return left.word_ == right.word_ && left.remaining_ == right.remaining_;
+        }
+
+    private:
+        friend class flags;
+
+        constexpr iterator(std::array<word_type, word_count> const* words, std::size_t word) noexcept
+            : words_(words), word_(word), remaining_(word < word_count ? (*words)[word] : 0)
+        {
+            skipEmptyWords();
+        }
+
+        constexpr void skipEmptyWords() noexcept
+        {
+            while (remaining_ == 0 && word_ < word_count)
+            {
+                ++word_;
+                remaining_ = word_ < word_count ? (*words_)[word_] : 0;
+            }
+        }
+
+        std::array<word_type, word_count> const* words_ = nullptr;
+        std::size_t word_ = word_count;
+        word_type remaining_ = 0;
+    };
+    using const_iterator = iterator;
+
+    constexpr flags() noexcept = default;
+    constexpr flags(std::initializer_list<Enum> values) noexcept
+    {
+        for (auto const value : values)
+        {
+            set(value);
+        }
+    }
+
+    FLUENT_NODISCARD static constexpr std::size_t size() noexcept
+    {
+        return Size;
+    }
+
+    FLUENT_NODISCARD constexpr bool test(Enum value) const noexcept
+    {
+        return (words_[wordOf(value)] & maskOf(value)) != 0;
+    }
+
+    constexpr flags& set(Enum value, bool on = true) noexcept
+    {
+        if (on)
+        {
+            words_[wordOf(value)] |= maskOf(value);
+        }
+        else
+        {
+            words_[wordOf(value)] &= ~maskOf(value);
+        }
+        return *this;
+    }
+
+    constexpr flags& set() noexcept
+    {
+        for (auto& word : words_)
+        {
+            word = ~word_type(0);
+        }
+        clearUnusedBits();
+        return *this;
+    }
+
+    constexpr flags& reset(Enum value) noexcept
+    {
+        return set(value, false);
+    }
+
+    constexpr flags& reset() noexcept
+    {
+        words_ = {};
+        return *this;
+    }
+
+    constexpr flags& flip(Enum value) noexcept
+    {
+        words_[wordOf(value)] ^= maskOf(value);
+        return *this;
+    }
+
+    // The number of flags that are set.
+    FLUENT_NODISCARD constexpr std::size_t count() const noexcept
+    {
+        std::size_t result = 0;
+        for (auto const word : words_)
+        {
+            result += static_cast<std::size_t>(std::popcount(word));
+        }
+        return result;
+    }
+
+    FLUENT_NODISCARD constexpr bool any() const noexcept
+    {
+        word_type result = 0;
+        for (auto const word : words_)
+        {
+            result |= word;
+        }
+        return result != 0;
+    }
+
+    FLUENT_NODISCARD constexpr bool none() const noexcept
+    {
+        return !any();
+    }
+
+    FLUENT_NODISCARD constexpr bool all() const noexcept
+    {
+        return *this == flags().set();
+    }
+
+    // True if all the flags of other are set in this one.
+    FLUENT_NODISCARD constexpr bool includes(flags const& other) const noexcept
+    {
+        word_type missing = 0;
+        for (std::size_t i = 0; i < word_count; ++i)
+        {
+            missing |= other.words_[i] & ~words_[i];
+        }
+        return missing == 0;
+    }
+
+    // True if at least one of the flags of other is set in this one.
+    FLUENT_NODISCARD constexpr bool intersects(flags const& other) const noexcept
+    {
+        word_type common = 0;
+        for (std::size_t i = 0; i < word_count; ++i)
+        {
+            common |= other.words_[i] & words_[i];
+        }
+        return common != 0;
+    }
+
+    // The flag of lowest value that is set, if any.
+    FLUENT_NODISCARD constexpr std::optional<Enum> first() const noexcept
+    {
+        auto const position = begin();
+        return position == end() ? std::nullopt : std::optional<Enum>(*position);
+    }
+
+    // Iterates over the flags that are set, in increasing order.
+    FLUENT_NODISCARD constexpr iterator begin() const noexcept
+    {
+        return iterator(&words_, 0);
+    }
+    FLUENT_NODISCARD constexpr iterator end() const noexcept
+    {
+        return iterator(&words_, word_count);
+    }
+
+    FLUENT_NODISCARD constexpr std::span<word_type const, word_count> words() const noexcept
+    {
+        return words_;
+    }
+
+    constexpr flags& operator&=(flags const& other) noexcept
+    {
+        for (std::size_t i = 0; i < word_count; ++i)
+        {
+            words_[i] &= other.words_[i];
+        }
+        return *this;
+    }
+    constexpr flags& operator|=(flags const& other) noexcept
+    {
+        for (std::size_t i = 0; i < word_count; ++i)
+        {
+            words_[i] |= other.words_[i];
+        }
+        return *this;
+    }
+    constexpr flags& operator^=(flags const& other) noexcept
+    {
+        for (std::size_t i = 0; i < word_count; ++i)
+        {
+            words_[i] ^= other.words_[i];
+        }
+        return *this;
+    }
+
+    FLUENT_NODISCARD friend constexpr flags operator&(flags left, flags const& right) noexcept
+    {
+        return left &= right;
+    }
+    FLUENT_NODISCARD friend constexpr flags operator|(flags left, flags const& right) noexcept
+    {
+        return left |= right;
+    }
+    FLUENT_NODISCARD friend constexpr flags operator^(flags left, flags const& right) noexcept
+    {
+        return left ^= right;
+    }
+    FLUENT_NODISCARD constexpr flags operator~() const noexcept
+    {
+        auto result = *this;
+        for (auto& word : result.words_)
+        {
+            word = ~word;
+        }
+        result.clearUnusedBits();
+        return result;
+    }
+
+    FLUENT_NODISCARD friend constexpr bool operator==(flags const& left, flags const& right) noexcept = default;
+
+private:
+    // All the accesses to a flag go through here. An enumerator past Size would address the words out of bounds,
+    // and makes the constant evaluations fail to compile.
+    static constexpr std::size_t wordOf(Enum value) noexcept
+    {
+        FLUENT_ASSERT(static_cast<std::size_t>(value) < Size);
+        return static_cast<std::size_t>(value) / bits_per_word;
+    }
+
+    static constexpr word_type maskOf(Enum value) noexcept
+    {
+        return word_type(1) << (static_cast<std::size_t>(value) % bits_per_word);
+    }
+
+    // The bits past Size stay cleared, so that count, all and the comparisons only see the flags.
+    constexpr void clearUnusedBits() noexcept
+    {
+        if constexpr (Size % bits_per_word != 0)
+        {
+            words_[word_count - 1] &= (word_type(1) << (Size % bits_per_word)) - 1;
+        }
+    }
+
+    std::array<word_type, word_count> words_{};
+};
+
+} // namespace fluent
+
+#endif
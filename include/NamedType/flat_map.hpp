@@ -0,0 +1,223 @@
+#ifndef NAMED_TYPE_FLAT_MAP_HPP
+#define NAMED_TYPE_FLAT_MAP_HPP
+
+#include "named_type_impl.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace fluent
+{
+
+struct sorted_unique_t
+{
+    explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+
+// A map keyed by a strong type, that stores its keys and its values in two sorted contiguous arrays.
+// Lookups are binary searches over the array of keys only, and iterations are linear scans:
+//
+//     flat_map<NodeId, Weight> weights(sorted_unique, std::move(sortedIds), std::move(idWeights));
+//     if (Weight const* weight = weights.find(id)) ...
+//     for (std::size_t i = 0; i < weights.size(); ++i) use(weights.keys()[i], weights.values()[i]);
+//
+// Inserting or erasing moves the elements after the position, so a flat_map is best built in bulk.
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class flat_map
+{
+    static_assert(details::IsNamedType<Key>, "the keys of a fluent::flat_map must be strong types");
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using key_compare = Compare;
+    using size_type = std::size_t;
+
+    flat_map() = default;
+
+    // Takes keys that are sorted according to Compare and without duplicates, and their values in the same order.
+    flat_map(sorted_unique_t, std::vector<Key> keys, std::vector<Value> values, Compare const& compare = Compare())
+        : keys_(std::move(keys)), values_(std::move(values)), compare_(compare)
+    {
+        if (keys_.size() != values_.size())
+        {
+            throw std::invalid_argument("a flat_map needs as many values as keys");
+        }
+    }
+
+    // Takes pairs of keys and values in any order. For equal keys, the first value is kept.
+    template <std::ranges::input_range Range>
+        requires std::is_constructible<std::pair<Key, Value>, std::ranges::range_reference_t<Range>>::value
+    explicit flat_map(Range&& keysAndValues, Compare const& compare = Compare()) : compare_(compare)
+    {
+        std::vector<std::pair<Key, Value>> elements;
+        for (auto&& element : keysAndValues)
+        {
+            elements.emplace_back(std::forward<decltype(element)>(element));
+        }
+        auto const compareKeys = [this](auto const& left, auto const& right) { return compare_(left.first, right.first); };
+        std::stable_sort(elements.begin(), elements.end(), compareKeys);
+        auto const equalKeys = [this](auto const& left, auto const& right) {
+            return !compare_(left.first, right.first) && !compare_(right.first, left.first);
+        };
+        elements.erase(std::unique(elements.begin(), elements.end(), equalKeys), elements.end());
+
+        keys_.reserve(elements.size());
+        values_.reserve(elements.size());
+        for (auto& element : elements)
+        {
+            keys_.push_back(std::move(element.first));
+            values_.push_back(std::move(element.second));
+        }
+    }
+
+    FLUENT_NODISCARD size_type size() const noexcept
+    {
+        return keys_.size();
+    }
+    FLUENT_NODISCARD bool empty() const noexcept
+    {
+        return keys_.empty();
+    }
+    void reserve(size_type capacity)
+    {
+        keys_.reserve(capacity);
+        values_.reserve(capacity);
+    }
+    void clear() noexcept
+    {
+        keys_.clear();
+        values_.clear();
+    }
+
+    FLUENT_NODISCARD bool contains(Key const& key) const
+    {
+        return find(key) != nullptr;
+    }
+
+    // Returns the value of key, or nullptr if key is not in the map.
+    FLUENT_NODISCARD Value* find(Key const& key)
+    {
+        auto const position = lowerBound(key);
+        return isAt(position, key) ? &values_[position] : nullptr;
+    }
+    FLUENT_NODISCARD Value const* find(Key const& key) const
+    {
+        auto const position = lowerBound(key);
+        return isAt(position, key) ? &values_[position] : nullptr;
+    }
+
+    // Throws std::out_of_range if key is not in the map.
+    FLUENT_NODISCARD Value& at(Key const& key)
+    {
+        auto const value = find(key);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("key not found in the flat_map");
+        }
+        return *value;
+    }
+    FLUENT_NODISCARD Value const& at(Key const& key) const
+    {
+        auto const value = find(key);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("key not found in the flat_map");
+        }
+        return *value;
+    }
+
+    // Inserts a value-initialized value if key is not in the map.
+    Value& operator[](Key const& key)
+    {
+        auto const position = lowerBound(key);
+        if (!isAt(position, key))
+        {
+            insertAt(position, key, Value());
+        }
+        return values_[position];
+    }
+
+    // Returns true if key was inserted, false if it was already in the map and its value was assigned.
+    template <typename V>
+    bool insert_or_assign(Key const& key, V&& value)
+    {
+        auto const position = lowerBound(key);
+        if (isAt(position, key))
+        {
+            values_[position] = std::forward<V>(value);
+            return false;
+        }
+        insertAt(position, key, std::forward<V>(value));
+        return true;
+    }
+
+    // Returns true if key was in the map.
+    bool erase(Key const& key)
+    {
+        auto const position = lowerBound(key);
+        if (!isAt(position, key))
+        {
+            return false;
+        }
+        keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(position));
+        values_.erase(values_.begin() + static_cast<std::ptrdiff_t>(position));
+        return true;
+    }
+
+    // The sorted keys, and their values at the same positions.
+    FLUENT_NODISCARD std::span<Key const> keys() const noexcept
+    {
+        return keys_;
+    }
+    FLUENT_NODISCARD std::span<Value> values() noexcept
+    {
+        return values_;
+    }
+    FLUENT_NODISCARD std::span<Value const> values() const noexcept
+    {
+        return values_;
+    }
+
+private:
+    size_type lowerBound(Key const& key) const
+    {
+        return static_cast<size_type>(std::lower_bound(keys_.begin(), keys_.end(), key, compare_) - keys_.begin());
+    }
+
+    bool isAt(size_type position, Key const& key) const
+    {
+        return position < keys_.size() && !compare_(key, keys_[position]);
+    }
+
+    template <typename V>
+    void insertAt(size_type position, Key const& key, V&& value)
+    {
+        keys_.insert(keys_.begin() + static_cast<std::ptrdiff_t>(position), key);
+        try
+        {
+            values_.insert(values_.begin() + static_cast<std::ptrdiff_t>(position), std::forward<V>(value));
+        }
+        catch (...)
+        {
+            keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(position));
+            throw;
+        }
+    }
+
+    std::vector<Key> keys_{};
+    std::vector<Value> values_{};
+    Compare compare_{};
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef NAMED_TYPE_FORMAT_HPP
+#define NAMED_TYPE_FORMAT_HPP
+
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+// Formatters for the strong types that have the Formattable skill, for std::format if the standard library
+// has it, and for {fmt} if it is available (FLUENT_FMT can be defined to 0 or 1 to override the detection).
+// They format the underlying value, with the same format specifications.
+
+#if __has_include(<format>)
+#    include <format>
+#endif
+
+#ifndef FLUENT_FMT
+#    if __has_include(<fmt/format.h>)
+#        define FLUENT_FMT 1
+#    else
+#        define FLUENT_FMT 0
+#    endif
+#endif
+
+#if FLUENT_FMT
+#    include <fmt/format.h>
+#endif
+
+#if defined(__cpp_lib_format)
+template <typename T, typename Parameter, template <typename> class... Skills, typename Char>
+    requires fluent::NamedType<T, Parameter, Skills...>::is_formattable
+struct std::formatter<fluent::NamedType<T, Parameter, Skills...>, Char> : std::formatter<T, Char>
+{
+    template <typename FormatContext>
+    auto format(fluent::NamedType<T, Parameter, Skills...> const& value, FormatContext& context) const
+    {
+        return std::formatter<T, Char>::format(value.get(), context);
+    }
+};
+#endif
+
+#if FLUENT_FMT
+template <typename T, typename Parameter, template <typename> class... Skills, typename Char>
+    requires fluent::NamedType<T, Parameter, Skills...>::is_formattable
+struct fmt::formatter<fluent::NamedType<T, Parameter, Skills...>, Char> : fmt::formatter<T, Char>
+{
+    template <typename FormatContext>
+    auto format(fluent::NamedType<T, Parameter, Skills...> const& value, FormatContext& context) const
+    {
+        return fmt::formatter<T, Char>::format(value.get(), context);
+    }
+};
+#endif
+
+#endif
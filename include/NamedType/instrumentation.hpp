@@ -0,0 +1,257 @@
+#ifndef NAMED_TYPE_INSTRUMENTATION_HPP
+#define NAMED_TYPE_INSTRUMENTATION_HPP
+
+// Opt-in counters of what happens to strong types, to find the ones that are copied or operated on the most.
+// Defining FLUENT_INSTRUMENT to 1 makes the strong types that have the Instrumented skill count, per type
+// and per thread, their constructions from a copy or a move of their underlying value, their conversions to
+// ref, and their binary arithmetic operations:
+//
+//     using Price = NamedType<double, struct PriceTag, Addable, Instrumented>;
+//     ...
+//     for (auto const& counters : fluent::instrumentation_snapshot()) export(counters);
+//
+// Otherwise the Instrumented skill and the hooks in the strong types compile to nothing, named_type_impl.hpp
+// does not even include this header, and the snapshot is empty.
+
+#ifndef FLUENT_INSTRUMENT
+#    define FLUENT_INSTRUMENT 0
+#endif
+
+// Size of the cache lines, used to keep data written by different threads on different lines.
+#ifndef FLUENT_CACHE_LINE_SIZE
+#    define FLUENT_CACHE_LINE_SIZE 64
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#if FLUENT_INSTRUMENT
+#    include <algorithm>
+#    include <atomic>
+#    include <cstdlib>
+#    include <memory>
+#    include <mutex>
+#    include <string>
+#    include <type_traits>
+#    include <typeinfo>
+#    include <utility>
+#    if defined(__has_include)
+#        if __has_include(<cxxabi.h>)
+#            include <cxxabi.h>
+#            define FLUENT_HAS_CXXABI 1
+#        endif
+#    endif
+#    ifndef FLUENT_HAS_CXXABI
+#        define FLUENT_HAS_CXXABI 0
+#    endif
+#endif
+
+namespace fluent
+{
+
+enum class instrumented_event : std::size_t
+{
+    copy_from_underlying,
+    move_from_underlying,
+    ref_conversion,
+    binary_operation
+};
+
+inline constexpr std::size_t instrumented_event_count = 4;
+
+struct instrumentation_counters
+{
+    // The name of the strong type, as given by std::type_info::name() and demangled where the ABI allows it.
+    std::string_view type_name;
+    std::array<std::uint64_t, instrumented_event_count> counts{};
+
+    std::uint64_t count(instrumented_event event) const noexcept
+    {
+        return counts[static_cast<std::size_t>(event)];
+    }
+};
+
+#if FLUENT_INSTRUMENT
+
+namespace details
+{
+// Written by a single thread, and read by the snapshots.
+struct alignas(FLUENT_CACHE_LINE_SIZE) InstrumentationSlot
+{
+    std::array<std::atomic<std::uint64_t>, instrumented_event_count> counts{};
+};
+
+inline std::string demangledName(char const* name)
+{
+#    if FLUENT_HAS_CXXABI
+    int status = 0;
+    auto const demangled = std::unique_ptr<char, void (*)(void*)>(abi::__cxa_demangle(name, nullptr, nullptr, &status), std::free);
+    if (status == 0 && demangled)
+    {
+        return demangled.get();
+    }
+#    endif
+    return name;
+}
+
+// The counters of one strong type: the slots of the threads that are running, and the totals of the finished ones.
+class InstrumentationRegistry
+{
+public:
+    explicit InstrumentationRegistry(std::string typeName);
+
+    void attach(InstrumentationSlot& slot)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        slots_.push_back(&slot);
+    }
+
+    void detach(InstrumentationSlot& slot)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (std::size_t event = 0; event < instrumented_event_count; ++event)
+        {
+            retired_[event] += slot.counts[event].load(std::memory_order_relaxed);
+        }
+        slots_.erase(std::remove(slots_.begin(), slots_.end(), &slot), slots_.end());
+    }
+
+    instrumentation_counters snapshot() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto counters = instrumentation_counters{typeName_, retired_};
+        for (auto const slot : slots_)
+        {
+            for (std::size_t event = 0; event < instrumented_event_count; ++event)
+            {
+                counters.counts[event] += slot->counts[event].load(std::memory_order_relaxed);
+            }
+        }
+        return counters;
+    }
+
+private:
+    std::string typeName_;
+    mutable std::mutex mutex_{};
+    std::vector<InstrumentationSlot*> slots_{};
+    std::array<std::uint64_t, instrumented_event_count> retired_{};
+};
+
+class InstrumentationRegistries
+{
+public:
+    static InstrumentationRegistries& instance()
+    {
+        static InstrumentationRegistries registries;
+        return registries;
+    }
+
+    void add(InstrumentationRegistry& registry)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        registries_.push_back(&registry);
+    }
+
+    std::vector<instrumentation_counters> snapshot() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<instrumentation_counters> counters;
+        counters.reserve(registries_.size());
+        for (auto const registry : registries_)
+        {
+            counters.push_back(registry->snapshot());
+        }
+        return counters;
+    }
+
+private:
+    InstrumentationRegistries() = default;
+
+    mutable std::mutex mutex_{};
+    std::vector<InstrumentationRegistry*> registries_{};
+};
+
+inline InstrumentationRegistry::InstrumentationRegistry(std::string typeName) : typeName_(std::move(typeName))
+{
+    InstrumentationRegistries::instance().add(*this);
+}
+
+template <typename NamedType_>
+InstrumentationRegistry& registryOf()
+{
+    static InstrumentationRegistry registry(demangledName(typeid(NamedType_).name()));
+    return registry;
+}
+
+template <typename NamedType_>
+struct ThreadInstrumentationSlot
+{
+    ThreadInstrumentationSlot()
+    {
+        registryOf<NamedType_>().attach(slot);
+    }
+    ~ThreadInstrumentationSlot()
+    {
+        registryOf<NamedType_>().detach(slot);
+    }
+    ThreadInstrumentationSlot(ThreadInstrumentationSlot const&) = delete;
+    ThreadInstrumentationSlot& operator=(ThreadInstrumentationSlot const&) = delete;
+
+    InstrumentationSlot slot{};
+};
+
+template <typename NamedType_>
+void incrementThreadCounter(instrumented_event event) noexcept
+{
+    try
+    {
+        thread_local ThreadInstrumentationSlot<NamedType_> threadSlot;
+        auto& counter = threadSlot.slot.counts[static_cast<std::size_t>(event)];
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    catch (...)
+    {
+        // The first event of a thread could not allocate its slot: it is not counted.
+    }
+}
+
+template <typename NamedType_>
+constexpr void recordEvent(instrumented_event event) noexcept
+{
+    if constexpr (requires { NamedType_::is_instrumented; })
+    {
+        if (!std::is_constant_evaluated())
+        {
+            incrementThreadCounter<NamedType_>(event);
+        }
+    }
+}
+} // namespace details
+
+#    define FLUENT_INSTRUMENT_EVENT(NamedType_, event) ::fluent::details::recordEvent<NamedType_>(::fluent::instrumented_event::event)
+
+// The counters of the instrumented strong types used so far, summed over all the threads.
+inline std::vector<instrumentation_counters> instrumentation_snapshot()
+{
+    return details::InstrumentationRegistries::instance().snapshot();
+}
+
+#else
+
+#    ifndef FLUENT_INSTRUMENT_EVENT
+#        define FLUENT_INSTRUMENT_EVENT(NamedType_, event) static_cast<void>(0)
+#    endif
+
+inline std::vector<instrumentation_counters> instrumentation_snapshot()
+{
+    return {};
+}
+
+#endif
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef NAMED_TYPE_INTERNED_STRING_HPP
+#define NAMED_TYPE_INTERNED_STRING_HPP
+
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace fluent
+{
+
+namespace details
+{
+// Stores each distinct string once, for the whole duration of the program. The table is split in shards
+// that each have their own lock, so that threads interning different strings rarely wait for each other,
+// and strings that are already interned are found under a shared lock.
+class InternTable
+{
+public:
+    // Leaked on purpose, so that the interned strings stay valid in the destructors of other static objects.
+    static InternTable& instance()
+    {
+        static auto& table = *new InternTable;
+        return table;
+    }
+
+    std::string const* intern(std::string_view text)
+    {
+        auto const hash = std::hash<std::string_view>()(text);
+        auto& shard = shards_[mixBits(hash) % shardCount];
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            auto const entry = shard.entries.find(text);
+            if (entry != shard.entries.end())
+            {
+                return entry->second;
+            }
+        }
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto const entry = shard.entries.find(text);
+        if (entry != shard.entries.end())
+        {
+            return entry->second;
+        }
+        // std::deque never moves its elements, so the views of the strings stay valid.
+        auto const& stored = shard.strings.emplace_back(text);
+        shard.entries.emplace(std::string_view(stored), &stored);
+        return &stored;
+    }
+
+    std::size_t size() const
+    {
+        std::size_t result = 0;
+        for (auto& shard : shards_)
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            result += shard.strings.size();
+        }
+        return result;
+    }
+
+private:
+    InternTable() = default;
+
+    static constexpr std::size_t shardCount = 16;
+
+    struct Shard
+    {
+        mutable std::shared_mutex mutex{};
+        std::deque<std::string> strings{};
+        std::unordered_map<std::string_view, std::string const*> entries{};
+    };
+
+    std::array<Shard, shardCount> shards_{};
+};
+} // namespace details
+
+// An immutable string that is stored once in a global table, and referred to by a pointer:
+//
+//     using Symbol = NamedType<InternedString, struct SymbolTag, Comparable, Hashable>;
+//     Symbol symbol(InternedString("AAPL"));
+//
+// Creating an InternedString looks the text up in the table, but copying, comparing for equality and hashing
+// only deal with the pointer. Ordering compares the characters. Interned strings are never freed,
+// so this suits sets of identifiers that are repeated many times, rather than arbitrary text.
+class InternedString
+{
+public:
+    constexpr InternedString() noexcept = default;
+    explicit InternedString(std::string_view text) : string_(text.empty() ? nullptr : details::InternTable::instance().intern(text))
+    {
+    }
+
+    FLUENT_NODISCARD std::string_view view() const noexcept
+    {
+        return string_ == nullptr ? std::string_view() : std::string_view(*string_);
+    }
+
+    FLUENT_NODISCARD char const* c_str() const noexcept
+    {
+        return string_ == nullptr ? "" : string_->c_str();
+    }
+
+    FLUENT_NODISCARD std::size_t size() const noexcept
+    {
+        return string_ == nullptr ? 0 : string_->size();
+    }
+
+    FLUENT_NODISCARD bool empty() const noexcept
+    {
+        return string_ == nullptr;
+    }
+
+    FLUENT_NODISCARD friend constexpr bool operator==(InternedString left, InternedString right) noexcept
+    {
+        return left.string_ == right.string_;
+    }
+
+    FLUENT_NODISCARD friend std::strong_ordering operator<=>(InternedString left, InternedString right) noexcept
+    {
+        if (left.string_ == right.string_)
+        {
+            return std::strong_ordering::equal;
+        }
+        return left.view() <=> right.view();
+    }
+
+    // The number of distinct strings interned so far.
+    FLUENT_NODISCARD static std::size_t interned_count()
+    {
+        return details::InternTable::instance().size();
+    }
+
+private:
+    friend struct std::hash<InternedString>;
+
+    std::string const* string_ = nullptr;
+};
+
+} // namespace fluent
+
+template <>
+struct std::hash<fluent::InternedString>
+{
+    std::size_t operator()(fluent::InternedString const& string) const noexcept
+    {
+        return fluent::details::mixBits(std::hash<std::string const*>()(string.string_));
+    }
+};
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef LAZY_ARITHMETIC_HPP
+#define LAZY_ARITHMETIC_HPP
+
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <functional>
+
+namespace fluent
+{
+
+// LazyArithmetic makes +, -, * and / build an expression node instead of a materialized value.
+// The expression keeps the strong type, and is evaluated when it gets converted to it:
+//
+//     using Samples = NamedType<std::valarray<double>, struct SamplesTag, LazyArithmetic>;
+//     Samples result = weights * samples + bias; // one loop, one allocation
+//
+// Element-wise underlying types (that have size(), operator[] and a constructor from a size) are
+// evaluated in a single fused loop, the other ones are evaluated as a whole. The element-wise operands
+// must all have the same size, which is checked with FLUENT_ASSERT.
+// The expression refers to its operands, so it should be evaluated before the end of the full expression.
+// LazyArithmetic is not meant to be combined with the eager arithmetic skills.
+template <typename T>
+struct LazyArithmetic
+{
+    static constexpr bool is_lazy_arithmetic = true;
+};
+
+namespace details
+{
+template <typename T>
+concept ElementWiseEvaluable = requires(T& value, T const& constValue, std::size_t index)
+{
+    T(index);
+    constValue.size();
+    value[index] = constValue[index];
+};
+
+template <typename NamedType_>
+struct LazyTerminal
+{
+    using strong_type = NamedType_;
+
+    NamedType_ const& operand;
+
+    constexpr decltype(auto) value() const
+    {
+        return operand.get();
+    }
+    constexpr decltype(auto) operator[](std::size_t index) const
+    {
+        return operand.get()[index];
+    }
+    constexpr std::size_t size() const
+    {
+        return operand.get().size();
+    }
+};
+} // namespace details
+
+template <typename NamedType_, typename Operation, typename Left, typename Right>
+struct LazyExpression
+{
+    using strong_type = NamedType_;
+
+    Left left;
+    Right right;
+
+    constexpr decltype(auto) value() const
+    {
+        return Operation{}(left.value(), right.value());
+    }
+    constexpr decltype(auto) operator[](std::size_t index) const
+    {
+        return Operation{}(left[index], right[index]);
+    }
+    // The operands of the element-wise operations must have the same size. Each node checks its own,
+    // and those of its operands through their size().
+    constexpr std::size_t size() const
+    {
+        auto const leftSize = left.size();
+        FLUENT_ASSERT(leftSize == right.size());
+        return leftSize;
+    }
+
+    FLUENT_NODISCARD constexpr operator NamedType_() const
+    {
+        using Underlying = typename NamedType_::UnderlyingType;
+        if constexpr (details::ElementWiseEvaluable<Underlying>)
+        {
+            auto const elements = size();
+            Underlying result(elements);
+            for (std::size_t index = 0; index < elements; ++index)
+            {
+                result[index] = (*this)[index];
+            }
+            return NamedType_(std::move(result));
+        }
+        else
+        {
+            return NamedType_(value());
+        }
+    }
+};
+
+template <typename NamedType_, typename Operation, typename Left, typename Right>
+FLUENT_NODISCARD constexpr NamedType_ evaluate(LazyExpression<NamedType_, Operation, Left, Right> const& expression)
+{
+    return expression;
+}
+
+namespace details
+{
+template <typename T>
+struct LazyOperand
+{
+    static constexpr bool value = false;
+};
+
+template <typename T>
+    requires(T::is_lazy_arithmetic)
+struct LazyOperand<T>
+{
+    static constexpr bool value = true;
+    using strong_type = T;
+    using node_type = LazyTerminal<T>;
+};
+
+template <typename NamedType_, typename Operation, typename Left, typename Right>
+struct LazyOperand<LazyExpression<NamedType_, Operation, Left, Right>>
+{
+    static constexpr bool value = true;
+    using strong_type = NamedType_;
+    using node_type = LazyExpression<NamedType_, Operation, Left, Right>;
+};
+
+template <typename Left, typename Right>
+concept LazyOperands = LazyOperand<Left>::value && LazyOperand<Right>::value
+                    && std::is_same<typename LazyOperand<Left>::strong_type, typename LazyOperand<Right>::strong_type>::value;
+
+template <typename Operation, typename Left, typename Right>
+constexpr auto makeLazyExpression(Left const& left, Right const& right)
+{
+    using LeftNode = typename LazyOperand<Left>::node_type;
+    using RightNode = typename LazyOperand<Right>::node_type;
+    return LazyExpression<typename LazyOperand<Left>::strong_type, Operation, LeftNode, RightNode>{LeftNode{left},
+                                                                                                   RightNode{right}};
+}
+} // namespace details
+
+template <typename Left, typename Right>
+    requires details::LazyOperands<Left, Right>
+FLUENT_NODISCARD constexpr auto operator+(Left const& left, Right const& right)
+{
+    return details::makeLazyExpression<std::plus<>>(left, right);
+}
+
+template <typename Left, typename Right>
+    requires details::LazyOperands<Left, Right>
+FLUENT_NODISCARD constexpr auto operator-(Left const& left, Right const& right)
+{
+    return details::makeLazyExpression<std::minus<>>(left, right);
+}
+
+template <typename Left, typename Right>
+    requires details::LazyOperands<Left, Right>
+FLUENT_NODISCARD constexpr auto operator*(Left const& left, Right const& right)
+{
+    return details::makeLazyExpression<std::multiplies<>>(left, right);
+}
+
+template <typename Left, typename Right>
+    requires details::LazyOperands<Left, Right>
+FLUENT_NODISCARD constexpr auto operator/(Left const& left, Right const& right)
+{
+    return details::makeLazyExpression<std::divides<>>(left, right);
+}
+
+} // namespace fluent
+
+#endif
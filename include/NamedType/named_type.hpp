@@ -1,6 +1,7 @@
 #ifndef NAMED_TYPE_HPP
 #define NAMED_TYPE_HPP
 
+#include "lazy_arithmetic.hpp"
 #include "named_type_impl.hpp"
 #include "underlying_functionalities.hpp"
 #include "version.hpp"
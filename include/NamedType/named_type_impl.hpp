@@ -1,7 +1,12 @@
 #ifndef named_type_impl_h
 #define named_type_impl_h
 
+#include <cassert>
 #include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -33,10 +38,81 @@
 #endif
 
 // Enable empty base class optimization with multiple inheritance on Visual Studio.
-#if defined(_MSC_VER) && _MSC_VER >= 1910
-#    define FLUENT_EBCO __declspec(empty_bases)
+// Defining FLUENT_EBCO to nothing beforehand disables it.
+#ifndef FLUENT_EBCO
+#    if defined(_MSC_VER) && _MSC_VER >= 1910
+#        define FLUENT_EBCO __declspec(empty_bases)
+#    else
+#        define FLUENT_EBCO
+#    endif
+#endif
+
+// Inline the trivial forwarding functions of the strong types and their skills even in unoptimized builds,
+// so that an operation on strong types costs about as much as on their underlying values in debug builds.
+// Defining FLUENT_ALWAYS_INLINE to nothing beforehand disables it, for example to step into them in a debugger.
+#ifndef FLUENT_ALWAYS_INLINE
+#    if defined(__GNUC__) || defined(__clang__)
+#        define FLUENT_ALWAYS_INLINE [[gnu::always_inline]]
+#    elif defined(_MSC_VER) && _MSC_VER >= 1930
+#        define FLUENT_ALWAYS_INLINE [[msvc::forceinline]]
+#    else
+#        define FLUENT_ALWAYS_INLINE
+#    endif
+#endif
+
+// Size of the cache lines, used to keep data written by different threads on different lines.
+#ifndef FLUENT_CACHE_LINE_SIZE
+#    define FLUENT_CACHE_LINE_SIZE 64
+#endif
+
+// Checks of the preconditions of the functions of the library, such as the sizes of the ranges passed to
+// the batch kernels. Defining FLUENT_ASSERT beforehand reports their failures in another way.
+#ifndef FLUENT_ASSERT
+#    define FLUENT_ASSERT(condition) assert(condition)
+#endif
+
+// Counting of the operations on the strong types that have the Instrumented skill, see instrumentation.hpp.
+#ifndef FLUENT_INSTRUMENT
+#    define FLUENT_INSTRUMENT 0
+#endif
+#if FLUENT_INSTRUMENT
+#    include "instrumentation.hpp"
 #else
-#    define FLUENT_EBCO
+#    define FLUENT_INSTRUMENT_EVENT(NamedType_, event) static_cast<void>(0)
+#endif
+
+// Checking of the invariants of the strong types that have the Validated skill, at their construction and
+// after their mutating operations. It is on by default unless NDEBUG is defined.
+#ifndef FLUENT_VALIDATE
+#    ifdef NDEBUG
+#        define FLUENT_VALIDATE 0
+#    else
+#        define FLUENT_VALIDATE 1
+#    endif
+#endif
+#if FLUENT_VALIDATE
+#    define FLUENT_VALIDATE_INVARIANT(NamedType_, value) ::fluent::details::checkInvariant<NamedType_>(value)
+#else
+#    define FLUENT_VALIDATE_INVARIANT(NamedType_, value) static_cast<void>(0)
+#endif
+
+// P1144 attribute, making the strong type trivially relocatable when its underlying type is.
+#if defined(__has_cpp_attribute)
+#    if __has_cpp_attribute(trivially_relocatable)
+#        define FLUENT_TRIVIALLY_RELOCATABLE_IF(condition) [[trivially_relocatable(condition)]]
+#    endif
+#endif
+#ifndef FLUENT_TRIVIALLY_RELOCATABLE_IF
+#    define FLUENT_TRIVIALLY_RELOCATABLE_IF(condition)
+#endif
+
+#if defined(__has_builtin)
+#    if __has_builtin(__is_trivially_relocatable)
+#        define FLUENT_HAS_TRIVIALLY_RELOCATABLE_BUILTIN 1
+#    endif
+#endif
+#ifndef FLUENT_HAS_TRIVIALLY_RELOCATABLE_BUILTIN
+#    define FLUENT_HAS_TRIVIALLY_RELOCATABLE_BUILTIN 0
 #endif
 
 #if defined(__clang__) || defined(__GNUC__)
@@ -60,8 +136,84 @@ using IsNotReference = typename std::enable_if<!std::is_reference<T>::value, voi
 template <typename T, typename... Args>
 concept NonNarrowingConstructible = requires { T{std::declval<Args>()...}; };
 
+// A skill is present if the strong type inherits from it, directly or through a bundle such as Arithmetic.
+// Query the elementary skills (BinaryAddable, PreIncrementable...): Arithmetic derives from them directly
+// and not from the intermediate bundles Addable, Subtractable, Incrementable and Decrementable.
+template <typename NamedType_, template <typename> class Skill>
+concept HasSkill = std::is_base_of<Skill<NamedType_>, NamedType_>::value;
+
+// Relocating an object (moving it to a new place and destroying the original) can be done with a memcpy
+// for such types. Customization point: specialize it for types that are trivially relocatable without
+// being trivially copyable. Strong types are trivially relocatable if their underlying type is.
+template <typename T>
+struct is_trivially_relocatable
+    : std::bool_constant<std::is_trivially_copyable<T>::value || std::is_reference<T>::value
+#if FLUENT_HAS_TRIVIALLY_RELOCATABLE_BUILTIN
+                         || __is_trivially_relocatable(T)
+#endif
+                         >
+{
+};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+// Constructs a strong type without checking its invariant, for values that are already known to be valid.
+struct unchecked_t
+{
+    explicit unchecked_t() = default;
+};
+inline constexpr unchecked_t unchecked{};
+
+namespace details
+{
+// Strong references are not checked: they refer to values that belong to someone else.
+template <typename NamedType_>
+concept HasInvariant = requires { NamedType_::is_validated; } && !std::is_reference<typename NamedType_::UnderlyingType>::value;
+
+template <typename NamedType_, typename Value>
+FLUENT_ALWAYS_INLINE constexpr void checkInvariant(Value& value)
+{
+    if constexpr (HasInvariant<NamedType_>)
+    {
+        NamedType_::check_invariant(value);
+    }
+}
+
+// The check of the values that come from outside the program, in validated(), from_chars and deserialize.
+// It is done in all builds, and even with the assert_valid policy if NDEBUG is defined.
+template <typename NamedType_, typename Value>
+FLUENT_ALWAYS_INLINE constexpr void checkAtBoundary(Value& value)
+{
+    if constexpr (HasInvariant<NamedType_>)
+    {
+        NamedType_::check_at_boundary(value);
+    }
+}
+
+// Whether checkInvariant and checkAtBoundary cannot throw, and whether the checks of FLUENT_VALIDATE_INVARIANT cannot throw.
+template <typename NamedType_>
+constexpr bool isNothrowChecked()
+{
+    if constexpr (HasInvariant<NamedType_>)
+    {
+        return NamedType_::is_nothrow_validated;
+    }
+    else
+    {
+        return true;
+    }
+}
+
+template <typename NamedType_>
+constexpr bool isNothrowValidated()
+{
+    return !FLUENT_VALIDATE || isNothrowChecked<NamedType_>();
+}
+} // namespace details
+
 template <typename T, typename Parameter, template <typename> class... Skills>
-class FLUENT_EBCO NamedType : public Skills<NamedType<T, Parameter, Skills...>>...
+class FLUENT_EBCO FLUENT_TRIVIALLY_RELOCATABLE_IF(is_trivially_relocatable<T>::value) NamedType : public Skills<NamedType<T, Parameter, Skills...>>...
 {
 public:
     using UnderlyingType = T;
@@ -69,14 +221,21 @@ public:
     // constructor
     NamedType()  = default;
 
-    explicit constexpr NamedType(T const& value) noexcept(std::is_nothrow_copy_constructible<T>::value) : value_{value}
+    FLUENT_ALWAYS_INLINE explicit constexpr NamedType(T const& value) noexcept(std::is_nothrow_copy_constructible<T>::value
+                                                                               && details::isNothrowValidated<NamedType>())
+        : value_{value}
     {
+        FLUENT_INSTRUMENT_EVENT(NamedType, copy_from_underlying);
+        FLUENT_VALIDATE_INVARIANT(NamedType, value_);
     }
 
     template <typename T_ = T, typename = IsNotReference<T_>>
-    explicit constexpr NamedType(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value)
-        : value_{std::move(value)}
+    FLUENT_ALWAYS_INLINE explicit constexpr NamedType(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value
+                                                                          && details::isNothrowValidated<NamedType>())
+        : value_{static_cast<T&&>(value)}
     {
+        FLUENT_INSTRUMENT_EVENT(NamedType, move_from_underlying);
+        FLUENT_VALIDATE_INVARIANT(NamedType, value_);
     }
 
     // Forwarding constructor for multi-arg construction or single-arg conversion.
@@ -87,32 +246,79 @@ public:
     template <typename... Args>
       requires (sizeof...(Args) > 1 || (sizeof...(Args) == 1 && !std::is_same_v<std::decay_t<Args>..., T>))
             && NonNarrowingConstructible<T, Args...>
-    explicit constexpr NamedType(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+    FLUENT_ALWAYS_INLINE explicit constexpr NamedType(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>
+                                                                               && details::isNothrowValidated<NamedType>())
       : value_{std::forward<Args>(args)...}
+    {
+        FLUENT_VALIDATE_INVARIANT(NamedType, value_);
+    }
+
+    template <typename... Args>
+        requires std::is_constructible<T, Args...>::value
+    FLUENT_ALWAYS_INLINE explicit constexpr NamedType(unchecked_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+        : value_(std::forward<Args>(args)...)
+    {
+    }
+
+    // Allocator-extended constructors, used by uses-allocator construction (std::pmr containers,
+    // std::scoped_allocator_adaptor...) when the underlying type uses an allocator.
+    template <typename Allocator, typename... Args>
+        requires std::uses_allocator<T, Allocator>::value
+              && (sizeof...(Args) != 1 || !std::is_same_v<std::remove_cvref_t<Args>..., NamedType>)
+    constexpr NamedType(std::allocator_arg_t, Allocator const& allocator, Args&&... args)
+        : value_(std::make_obj_using_allocator<T>(allocator, std::forward<Args>(args)...))
+    {
+        FLUENT_VALIDATE_INVARIANT(NamedType, value_);
+    }
+
+    template <typename Allocator>
+        requires std::uses_allocator<T, Allocator>::value
+    constexpr NamedType(std::allocator_arg_t, Allocator const& allocator, NamedType const& other)
+        : value_(std::make_obj_using_allocator<T>(allocator, other.value_))
+    {
+    }
+
+    template <typename Allocator>
+        requires std::uses_allocator<T, Allocator>::value
+    constexpr NamedType(std::allocator_arg_t, Allocator const& allocator, NamedType&& other)
+        : value_(std::make_obj_using_allocator<T>(allocator, std::move(other.value_)))
     {
     }
 
     // get
-    FLUENT_NODISCARD constexpr T& get() noexcept
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T& get() & noexcept
     {
         return value_;
     }
 
-    FLUENT_NODISCARD constexpr std::remove_reference_t<T> const& get() const noexcept
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr std::remove_reference_t<T> const& get() const& noexcept
     {
         return value_;
     }
 
+    // An expiring strong type hands over its value, a strong reference still gives the referenced object.
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T&& get() && noexcept
+    {
+        return static_cast<T&&>(value_);
+    }
+
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr std::conditional_t<std::is_reference<T>::value, std::remove_reference_t<T> const&, T const&&>
+    get() const&& noexcept
+    {
+        return static_cast<std::remove_reference_t<T> const&&>(value_);
+    }
+
     // conversions
     using ref = NamedType<T&, Parameter, Skills...>;
-    operator ref()
+    FLUENT_ALWAYS_INLINE constexpr operator ref()
     {
+        FLUENT_INSTRUMENT_EVENT(NamedType, ref_conversion);
         return ref(value_);
     }
 
     struct argument
     {
-       NamedType operator=(T&& value) const
+       constexpr NamedType operator=(T&& value) const
        {
            IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
@@ -123,7 +329,7 @@ public:
         // Rejects narrowing conversions (e.g. uint64_t -> uint32_t)
         template <typename U>
           requires NonNarrowingConstructible<T, U>
-        NamedType operator=(U&& value) const
+        constexpr NamedType operator=(U&& value) const
         {
             IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
@@ -143,6 +349,124 @@ private:
     T value_;
 };
 
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct is_trivially_relocatable<NamedType<T, Parameter, Skills...>> : is_trivially_relocatable<T>
+{
+};
+
+// Relocates [first, last) into the uninitialized memory starting at result, and returns the end of the result.
+// The source objects are destroyed, and the ranges may overlap if result <= first.
+template <typename T>
+T* uninitialized_relocate(T* first, T* last, T* result) noexcept(
+    is_trivially_relocatable<T>::value || std::is_nothrow_move_constructible<T>::value)
+{
+    if constexpr (is_trivially_relocatable<T>::value)
+    {
+        auto const count = last - first;
+        if (count > 0)
+        {
+            std::memmove(static_cast<void*>(result), static_cast<void const*>(first), static_cast<std::size_t>(count) * sizeof(T));
+        }
+        return result + count;
+    }
+    else
+    {
+        for (; first != last; ++first, ++result)
+        {
+            ::new (static_cast<void*>(result)) T(std::move(*first));
+            first->~T();
+        }
+        return result;
+    }
+}
+
+template <template <typename T> class StrongType, typename T>
+constexpr StrongType<T> make_named(T const& value)
+{
+    return StrongType<T>(value);
+}
+
+namespace details
+{
+template <typename T>
+struct is_named_type : std::false_type
+{
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct is_named_type<NamedType<T, Parameter, Skills...>> : std::true_type
+{
+};
+
+template <typename T>
+concept IsNamedType = is_named_type<T>::value;
+
+template <typename T, typename... Ts>
+constexpr std::size_t indexOf()
+{
+    constexpr bool matches[] = {std::is_same<T, Ts>::value..., false};
+    for (std::size_t index = 0; index < sizeof...(Ts); ++index)
+    {
+        if (matches[index])
+        {
+            return index;
+        }
+    }
+    return sizeof...(Ts);
+}
+
+template <typename T, typename... Ts>
+constexpr std::size_t occurrences()
+{
+    return (std::size_t{0} + ... + (std::is_same<T, Ts>::value ? 1 : 0));
+}
+
+// Calls f with the arguments reordered into the order of Parameters. The arguments are only bound by
+// reference and forwarded to f, so none of them is copied or moved on the way.
+template <typename F, typename... Parameters>
+struct NamedArgsFunction
+{
+    static_assert(((occurrences<Parameters, Parameters...>() == 1) && ...), "each parameter must have its own type");
+
+    F f;
+
+    template <typename... Args>
+    constexpr decltype(auto) operator()(Args&&... args) const
+    {
+        static_assert(sizeof...(Args) == sizeof...(Parameters), "Passing wrong number of arguments");
+        static_assert(((indexOf<Parameters, std::remove_cvref_t<Args>...>() < sizeof...(Args)) && ...),
+                      "Missing argument");
+        auto arguments = std::forward_as_tuple(std::forward<Args>(args)...);
+        return f(std::get<indexOf<Parameters, std::remove_cvref_t<Args>...>()>(std::move(arguments))...);
+    }
+};
+} // namespace details
+
+// Makes a function that accepts its strong type arguments in any order:
+//
+//     auto displayName = named_args<FirstName, LastName>([](FirstName const&, LastName const&) { ... });
+//     displayName(lastName = "Doe", firstName = "John");
+//
+// The order is resolved at compile time, and the arguments go straight into f without intermediate copies.
+template <typename... Parameters, typename F>
+constexpr auto named_args(F&& f)
+{
+    return details::NamedArgsFunction<std::decay_t<F>, Parameters...>{std::forward<F>(f)};
+}
+
+// EXPERIMENTAL - CAN BE CHANGED IN THE FUTURE. FEEDBACK WELCOME FOR IMPROVEMENTS!
+template <typename... Args, typename F>
+auto make_named_arg_function(F&& f)
+{
+    return named_args<Args...>(std::forward<F>(f));
+}
+
 } // namespace fluent
 
+// A strong type uses an allocator if its underlying type does.
+template <typename T, typename Parameter, template <typename> class... Skills, typename Allocator>
+struct std::uses_allocator<fluent::NamedType<T, Parameter, Skills...>, Allocator> : std::uses_allocator<T, Allocator>
+{
+};
+
 #endif /* named_type_impl_h */
@@ -0,0 +1,157 @@
+#ifndef NAMED_TYPE_PARALLEL_HPP
+#define NAMED_TYPE_PARALLEL_HPP
+
+#include "named_type_impl.hpp"
+#include "reduction.hpp"
+#include "span.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+// Reductions and scans over ranges of strong types, that run with the parallel algorithms of the standard library:
+//
+//     std::vector<Meter> distances = ...;
+//     Meter total = fluent::par::sum(distances);
+//     Meter longest = fluent::par::max(std::execution::par, distances);
+//
+// They start from the identity element of their operation, given by fluent::identity from reduction.hpp. Ranges that are
+// contiguous and have the layout of their underlying type are processed as arrays of the underlying type,
+// so that the algorithms can vectorize them. Each operation is available only if the strong type has the
+// corresponding skill, and runs with std::execution::par_unseq unless given another execution policy.
+//
+// With libstdc++, the parallel policies run on TBB when its headers are found, and the program then needs
+// to link with it. Otherwise they run sequentially.
+
+namespace fluent
+{
+
+namespace details
+{
+template <typename Range, template <typename> class Skill>
+concept ParallelRange = std::ranges::forward_range<Range> && std::ranges::sized_range<Range>
+                     && HasSkill<std::ranges::range_value_t<Range>, Skill>;
+
+template <typename Range, typename NamedType_>
+concept ParallelOutput = std::ranges::forward_range<Range> && std::ranges::sized_range<Range>
+                      && std::is_same<std::ranges::range_value_t<Range>, NamedType_>::value
+                      && std::indirectly_writable<std::ranges::iterator_t<Range>, NamedType_>;
+
+template <typename ExecutionPolicy>
+concept ExecutionPolicyOf = std::is_execution_policy<std::remove_cvref_t<ExecutionPolicy>>::value;
+
+// The operations are applied either to the strong types or to their underlying values,
+// so Operation must be one of the generic function objects of reduction.hpp.
+template <typename ExecutionPolicy, typename Range, typename Operation>
+auto reduce(ExecutionPolicy&& policy, Range const& range, Operation operation)
+{
+    using NamedType_ = std::ranges::range_value_t<Range>;
+    auto const init = identity<NamedType_, Operation>::value();
+    if constexpr (UnderlyingContiguous<Range>)
+    {
+        auto const values = as_underlying_span(range);
+        return NamedType_(std::reduce(std::forward<ExecutionPolicy>(policy), values.begin(), values.end(), init.get(), operation));
+    }
+    else
+    {
+        return std::reduce(std::forward<ExecutionPolicy>(policy), std::ranges::begin(range), std::ranges::end(range), init, operation);
+    }
+}
+} // namespace details
+
+namespace par
+{
+
+template <typename ExecutionPolicy, typename Range>
+    requires details::ExecutionPolicyOf<ExecutionPolicy> && details::ParallelRange<Range, BinaryAddable>
+FLUENT_NODISCARD auto sum(ExecutionPolicy&& policy, Range const& range)
+{
+    return details::reduce(std::forward<ExecutionPolicy>(policy), range, std::plus<>());
+}
+
+template <typename Range>
+    requires details::ParallelRange<Range, BinaryAddable>
+FLUENT_NODISCARD auto sum(Range const& range)
+{
+    return sum(std::execution::par_unseq, range);
+}
+
+template <typename ExecutionPolicy, typename Range>
+    requires details::ExecutionPolicyOf<ExecutionPolicy> && details::ParallelRange<Range, Multiplicable>
+FLUENT_NODISCARD auto product(ExecutionPolicy&& policy, Range const& range)
+{
+    return details::reduce(std::forward<ExecutionPolicy>(policy), range, std::multiplies<>());
+}
+
+template <typename Range>
+    requires details::ParallelRange<Range, Multiplicable>
+FLUENT_NODISCARD auto product(Range const& range)
+{
+    return product(std::execution::par_unseq, range);
+}
+
+// The smallest element, or the identity of minimum if the range is empty.
+template <typename ExecutionPolicy, typename Range>
+    requires details::ExecutionPolicyOf<ExecutionPolicy> && details::ParallelRange<Range, Comparable>
+FLUENT_NODISCARD auto min(ExecutionPolicy&& policy, Range const& range)
+{
+    return details::reduce(std::forward<ExecutionPolicy>(policy), range, minimum());
+}
+
+template <typename Range>
+    requires details::ParallelRange<Range, Comparable>
+FLUENT_NODISCARD auto min(Range const& range)
+{
+    return min(std::execution::par_unseq, range);
+}
+
+// The largest element, or the identity of maximum if the range is empty.
+template <typename ExecutionPolicy, typename Range>
+    requires details::ExecutionPolicyOf<ExecutionPolicy> && details::ParallelRange<Range, Comparable>
+FLUENT_NODISCARD auto max(ExecutionPolicy&& policy, Range const& range)
+{
+    return details::reduce(std::forward<ExecutionPolicy>(policy), range, maximum());
+}
+
+template <typename Range>
+    requires details::ParallelRange<Range, Comparable>
+FLUENT_NODISCARD auto max(Range const& range)
+{
+    return max(std::execution::par_unseq, range);
+}
+
+// Writes the running sums of input into result, that must have the same size. The result may alias the input.
+template <typename ExecutionPolicy, typename Input, typename Result>
+    requires details::ExecutionPolicyOf<ExecutionPolicy> && details::ParallelRange<Input, BinaryAddable>
+          && details::ParallelOutput<Result, std::ranges::range_value_t<Input>>
+void inclusive_scan(ExecutionPolicy&& policy, Input const& input, Result&& result)
+{
+    if constexpr (details::UnderlyingContiguous<Input> && details::UnderlyingContiguous<Result>)
+    {
+        auto const values = as_underlying_span(input);
+        auto const sums = as_underlying_span(result);
+        std::inclusive_scan(std::forward<ExecutionPolicy>(policy), values.begin(), values.end(), sums.begin(), std::plus<>());
+    }
+    else
+    {
+        std::inclusive_scan(std::forward<ExecutionPolicy>(policy), std::ranges::begin(input), std::ranges::end(input),
+                            std::ranges::begin(result), std::plus<>());
+    }
+}
+
+template <typename Input, typename Result>
+    requires details::ParallelRange<Input, BinaryAddable> && details::ParallelOutput<Result, std::ranges::range_value_t<Input>>
+void inclusive_scan(Input const& input, Result&& result)
+{
+    inclusive_scan(std::execution::par_unseq, input, std::forward<Result>(result));
+}
+
+} // namespace par
+} // namespace fluent
+
+#endif
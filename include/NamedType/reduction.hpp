@@ -0,0 +1,141 @@
+#ifndef NAMED_TYPE_REDUCTION_HPP
+#define NAMED_TYPE_REDUCTION_HPP
+
+#include "named_type_impl.hpp"
+#include "span.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <utility>
+
+// The identity elements of the reductions over strong types, and the sequential reduction that starts from them.
+// They are shared by batch.hpp and parallel.hpp, and do not depend on <execution>, so that the sequential
+// kernels do not pull in the parallel algorithms of the standard library.
+
+namespace fluent
+{
+
+// The smaller and the larger of two values, as function objects with the interface of std::plus<>.
+struct minimum
+{
+    template <typename T>
+    FLUENT_NODISCARD constexpr T operator()(T const& left, T const& right) const
+    {
+        return right < left ? right : left;
+    }
+};
+
+struct maximum
+{
+    template <typename T>
+    FLUENT_NODISCARD constexpr T operator()(T const& left, T const& right) const
+    {
+        return left < right ? right : left;
+    }
+};
+
+// The identity element of Operation over the strong type NamedType_, in a static function value().
+// It is defined for std::plus<> and std::multiplies<> if the strong type is addable or multiplicable,
+// and for minimum and maximum if it is comparable and its underlying type is numeric.
+// It can be specialized for strong types whose identities are not those of their underlying type.
+template <typename NamedType_, typename Operation>
+struct identity;
+
+template <typename NamedType_>
+    requires HasSkill<NamedType_, BinaryAddable>
+struct identity<NamedType_, std::plus<>>
+{
+    static constexpr NamedType_ value()
+    {
+        return NamedType_(typename NamedType_::UnderlyingType{});
+    }
+};
+
+template <typename NamedType_>
+    requires HasSkill<NamedType_, Multiplicable>
+struct identity<NamedType_, std::multiplies<>>
+{
+    static constexpr NamedType_ value()
+    {
+        return NamedType_(typename NamedType_::UnderlyingType{1});
+    }
+};
+
+template <typename NamedType_>
+    requires HasSkill<NamedType_, Comparable> && std::numeric_limits<typename NamedType_::UnderlyingType>::is_specialized
+struct identity<NamedType_, minimum>
+{
+    static constexpr NamedType_ value()
+    {
+        using Limits = std::numeric_limits<typename NamedType_::UnderlyingType>;
+        if constexpr (Limits::has_infinity)
+        {
+            return NamedType_(Limits::infinity());
+        }
+        else
+        {
+            return NamedType_(Limits::max());
+        }
+    }
+};
+
+template <typename NamedType_>
+    requires HasSkill<NamedType_, Comparable> && std::numeric_limits<typename NamedType_::UnderlyingType>::is_specialized
+struct identity<NamedType_, maximum>
+{
+    static constexpr NamedType_ value()
+    {
+        using Limits = std::numeric_limits<typename NamedType_::UnderlyingType>;
+        if constexpr (Limits::has_infinity)
+        {
+            return NamedType_(-Limits::infinity());
+        }
+        else
+        {
+            return NamedType_(Limits::lowest());
+        }
+    }
+};
+
+// A strong type with an underlying value that is initialized, unlike the one of NamedType_{} for trivial types.
+template <typename NamedType_>
+FLUENT_NODISCARD constexpr NamedType_ zero_of()
+{
+    return identity<NamedType_, std::plus<>>::value();
+}
+
+template <typename NamedType_>
+FLUENT_NODISCARD constexpr NamedType_ one_of()
+{
+    return identity<NamedType_, std::multiplies<>>::value();
+}
+
+namespace details
+{
+template <typename Range>
+concept UnderlyingContiguous = std::ranges::contiguous_range<Range> && UnderlyingLayoutCompatible<std::ranges::range_value_t<Range>>;
+
+// Reduces the range sequentially, as arrays of the underlying type if it is contiguous.
+// Operation must be one of the generic function objects above, that apply both to the strong types and to their underlying values.
+template <typename Range, typename Operation>
+auto reduce(Range const& range, Operation operation)
+{
+    using NamedType_ = std::ranges::range_value_t<Range>;
+    auto const init = identity<NamedType_, Operation>::value();
+    if constexpr (UnderlyingContiguous<Range>)
+    {
+        auto const values = as_underlying_span(range);
+        return NamedType_(std::reduce(values.begin(), values.end(), init.get(), operation));
+    }
+    else
+    {
+        return std::reduce(std::ranges::begin(range), std::ranges::end(range), init, operation);
+    }
+}
+} // namespace details
+} // namespace fluent
+
+#endif
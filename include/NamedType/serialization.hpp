@@ -0,0 +1,180 @@
+#ifndef NAMED_TYPE_SERIALIZATION_HPP
+#define NAMED_TYPE_SERIALIZATION_HPP
+
+#include "named_type_impl.hpp"
+#include "span.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+// Binary serialization of strong types with a trivially copyable underlying type, in an explicit byte order:
+//
+//     using Price = NamedType<int64_t, struct PriceTag, Serializable>;
+//     std::span<std::byte> rest = fluent::serialize<std::endian::little>(prices, buffer);
+//
+// Data written in the native byte order can then be read back without copy, for example from a memory-mapped file:
+//
+//     std::span<Price const> prices = fluent::view_as<Price, std::endian::little>(mappedBytes);
+//
+// These functions throw std::length_error if a buffer is too small, and view_as throws std::invalid_argument
+// if the bytes are not suitably aligned or sized.
+
+namespace fluent
+{
+
+template <typename T>
+struct Serializable
+{
+    static constexpr bool is_serializable = true;
+};
+
+template <typename NamedType_>
+concept SerializableNamedType = details::IsNamedType<NamedType_> && HasSkill<NamedType_, Serializable>
+                             && !std::is_reference<typename NamedType_::UnderlyingType>::value
+                             && std::is_trivially_copyable<typename NamedType_::UnderlyingType>::value;
+
+namespace details
+{
+// Other byte orders than the native one are supported for scalar types only, whose bytes can be reversed.
+template <typename T, std::endian Order>
+concept SerializableInOrder = Order == std::endian::native || sizeof(T) == 1 || std::is_arithmetic<T>::value || std::is_enum<T>::value;
+
+template <std::endian Order, typename T>
+void storeBytes(T const& value, std::byte* out) noexcept
+{
+    std::memcpy(out, &value, sizeof(T));
+    if constexpr (Order != std::endian::native)
+    {
+        std::reverse(out, out + sizeof(T));
+    }
+}
+
+template <std::endian Order, typename T>
+T loadBytes(std::byte const* in) noexcept
+{
+    std::byte bytes[sizeof(T)];
+    std::memcpy(bytes, in, sizeof(T));
+    if constexpr (Order != std::endian::native)
+    {
+        std::reverse(std::begin(bytes), std::end(bytes));
+    }
+    return std::bit_cast<T>(bytes);
+}
+
+inline void checkBufferSize(std::size_t available, std::size_t needed)
+{
+    if (available < needed)
+    {
+        throw std::length_error("the buffer is too small for the serialized strong types");
+    }
+}
+
+template <typename Range>
+concept SerializableRange = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>
+                         && SerializableNamedType<std::ranges::range_value_t<Range>>;
+} // namespace details
+
+// Writes the underlying bytes of value at the beginning of buffer, and returns the rest of the buffer.
+template <std::endian Order, typename NamedType_>
+    requires SerializableNamedType<NamedType_> && details::SerializableInOrder<typename NamedType_::UnderlyingType, Order>
+std::span<std::byte> serialize(NamedType_ const& value, std::span<std::byte> buffer)
+{
+    using T = typename NamedType_::UnderlyingType;
+    details::checkBufferSize(buffer.size(), sizeof(T));
+    details::storeBytes<Order>(value.get(), buffer.data());
+    return buffer.subspan(sizeof(T));
+}
+
+// Writes the underlying bytes of the values one after the other, and returns the rest of the buffer.
+template <std::endian Order, typename Range>
+    requires details::SerializableRange<Range>
+          && details::SerializableInOrder<typename std::ranges::range_value_t<Range>::UnderlyingType, Order>
+std::span<std::byte> serialize(Range const& values, std::span<std::byte> buffer)
+{
+    using NamedType_ = std::ranges::range_value_t<Range>;
+    using T = typename NamedType_::UnderlyingType;
+    auto const count = std::ranges::size(values);
+    details::checkBufferSize(buffer.size(), count * sizeof(T));
+    if constexpr (Order == std::endian::native && UnderlyingLayoutCompatible<NamedType_>)
+    {
+        if (count > 0)
+        {
+            std::memcpy(buffer.data(), as_underlying_span(values).data(), count * sizeof(T));
+        }
+    }
+    else
+    {
+        auto out = buffer.data();
+        for (auto const& value : values)
+        {
+            details::storeBytes<Order>(value.get(), out);
+            out += sizeof(T);
+        }
+    }
+    return buffer.subspan(count * sizeof(T));
+}
+
+// Reads a value written by serialize at the beginning of bytes. The values of a Validated strong type
+// are checked even when FLUENT_VALIDATE is 0, since they come from outside the program.
+template <typename NamedType_, std::endian Order>
+    requires SerializableNamedType<NamedType_> && details::SerializableInOrder<typename NamedType_::UnderlyingType, Order>
+FLUENT_NODISCARD NamedType_ deserialize(std::span<std::byte const> bytes)
+{
+    using T = typename NamedType_::UnderlyingType;
+    details::checkBufferSize(bytes.size(), sizeof(T));
+    auto value = details::loadBytes<Order, T>(bytes.data());
+    details::checkAtBoundary<NamedType_>(value);
+    return NamedType_(unchecked, value);
+}
+
+// Reads as many values as values can hold, and returns the rest of bytes. The values are checked like
+// the one of the function above. If a check throws, the values before it are already read.
+template <std::endian Order, typename Range>
+    requires details::SerializableRange<Range>
+          && details::SerializableInOrder<typename std::ranges::range_value_t<Range>::UnderlyingType, Order>
+std::span<std::byte const> deserialize(std::span<std::byte const> bytes, Range&& values)
+{
+    using NamedType_ = std::ranges::range_value_t<Range>;
+    using T = typename NamedType_::UnderlyingType;
+    details::checkBufferSize(bytes.size(), std::ranges::size(values) * sizeof(T));
+    auto in = bytes.data();
+    for (auto& value : values)
+    {
+        auto loaded = details::loadBytes<Order, T>(in);
+        details::checkAtBoundary<NamedType_>(loaded);
+        value.get() = loaded;
+        in += sizeof(T);
+    }
+    return bytes.subspan(std::ranges::size(values) * sizeof(T));
+}
+
+// Views bytes written by serialize as strong types, without copy. It is only available for the bytes
+// written in the native byte order, unless the underlying type has a single byte: the others must be deserialized.
+// The values viewed are not checked against the invariants of Validated strong types.
+template <typename NamedType_, std::endian Order>
+    requires SerializableNamedType<NamedType_> && UnderlyingLayoutCompatible<NamedType_>
+          && (Order == std::endian::native || sizeof(typename NamedType_::UnderlyingType) == 1)
+FLUENT_NODISCARD std::span<NamedType_ const> view_as(std::span<std::byte const> bytes)
+{
+    using T = typename NamedType_::UnderlyingType;
+    if (reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(T) != 0)
+    {
+        throw std::invalid_argument("the serialized strong types are not aligned for their underlying type");
+    }
+    if (bytes.size() % sizeof(T) != 0)
+    {
+        throw std::invalid_argument("the size of the serialized data is not a multiple of the size of the underlying type");
+    }
+    return std::span<NamedType_ const>(reinterpret_cast<NamedType_ const*>(bytes.data()), bytes.size() / sizeof(T));
+}
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef NAMED_TYPE_SOA_VECTOR_HPP
+#define NAMED_TYPE_SOA_VECTOR_HPP
+
+#include "named_type_impl.hpp"
+#include "span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fluent
+{
+
+// Structure of arrays: a sequence of records made of strong types, where each field is stored in its own
+// contiguous column of underlying values. Columns are accessed as spans of the strong type:
+//
+//     soa_vector<Price, Quantity, OrderId> orders;
+//     orders.push_back(Price(1050), Quantity(100u), OrderId(1u));
+//     std::span<Quantity> quantities = orders.column<Quantity>();
+//
+// Each strong type must appear once, and have the layout of its underlying type.
+template <typename... NamedTypes>
+class soa_vector
+{
+    static_assert(sizeof...(NamedTypes) > 0, "soa_vector needs at least one column");
+    static_assert((UnderlyingLayoutCompatible<NamedTypes> && ...),
+                  "the columns must be strong types with the layout of their underlying type");
+    static_assert(((details::occurrences<NamedTypes, NamedTypes...>() == 1) && ...), "each column must have its own type");
+
+public:
+    using size_type = std::size_t;
+
+    soa_vector() = default;
+
+    FLUENT_NODISCARD size_type size() const noexcept
+    {
+        return std::get<0>(columns_).size();
+    }
+
+    FLUENT_NODISCARD bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    void reserve(size_type capacity)
+    {
+        std::apply([capacity](auto&... columns) { (columns.reserve(capacity), ...); }, columns_);
+    }
+
+    // If an exception is thrown, the container is left unchanged.
+    void resize(size_type newSize)
+    {
+        auto const previousSize = size();
+        try
+        {
+            std::apply([newSize](auto&... columns) { (columns.resize(newSize), ...); }, columns_);
+        }
+        catch (...)
+        {
+            truncate(previousSize);
+            throw;
+        }
+    }
+
+    void clear() noexcept
+    {
+        std::apply([](auto&... columns) noexcept { (columns.clear(), ...); }, columns_);
+    }
+
+    // If an exception is thrown, the container is left unchanged.
+    void push_back(NamedTypes const&... values)
+    {
+        auto const previousSize = size();
+        try
+        {
+            pushBack(std::index_sequence_for<NamedTypes...>{}, values...);
+        }
+        catch (...)
+        {
+            truncate(previousSize);
+            throw;
+        }
+    }
+
+    void pop_back() noexcept
+    {
+        std::apply([](auto&... columns) noexcept { (columns.pop_back(), ...); }, columns_);
+    }
+
+    FLUENT_NODISCARD std::tuple<NamedTypes&...> operator[](size_type index)
+    {
+        return std::tuple<NamedTypes&...>(column<NamedTypes>()[index]...);
+    }
+
+    FLUENT_NODISCARD std::tuple<NamedTypes const&...> operator[](size_type index) const
+    {
+        return std::tuple<NamedTypes const&...>(column<NamedTypes>()[index]...);
+    }
+
+    template <typename NamedType_>
+    FLUENT_NODISCARD std::span<NamedType_> column() noexcept
+    {
+        return as_named_span<NamedType_>(underlying_column<NamedType_>());
+    }
+
+    template <typename NamedType_>
+    FLUENT_NODISCARD std::span<NamedType_ const> column() const noexcept
+    {
+        return as_named_span<NamedType_>(underlying_column<NamedType_>());
+    }
+
+    template <typename NamedType_>
+    FLUENT_NODISCARD std::span<typename NamedType_::UnderlyingType> underlying_column() noexcept
+    {
+        return std::get<columnIndex<NamedType_>()>(columns_);
+    }
+
+    template <typename NamedType_>
+    FLUENT_NODISCARD std::span<typename NamedType_::UnderlyingType const> underlying_column() const noexcept
+    {
+        return std::get<columnIndex<NamedType_>()>(columns_);
+    }
+
+private:
+    template <typename NamedType_>
+    static constexpr std::size_t columnIndex()
+    {
+        constexpr auto index = details::indexOf<NamedType_, NamedTypes...>();
+        static_assert(index < sizeof...(NamedTypes), "no such column in the soa_vector");
+        return index;
+    }
+
+    template <std::size_t... Indexes>
+    void pushBack(std::index_sequence<Indexes...>, NamedTypes const&... values)
+    {
+        (std::get<Indexes>(columns_).push_back(values.get()), ...);
+    }
+
+    void truncate(size_type newSize) noexcept
+    {
+        std::apply(
+            [newSize](auto&... columns) noexcept {
+                (columns.erase(columns.begin() + static_cast<std::ptrdiff_t>(std::min(newSize, columns.size())), columns.end()),
+                 ...);
+            },
+            columns_);
+    }
+
+    std::tuple<std::vector<typename NamedTypes::UnderlyingType>...> columns_{};
+};
+
+} // namespace fluent
+
+#endif
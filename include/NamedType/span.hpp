@@ -0,0 +1,78 @@
+#ifndef NAMED_TYPE_SPAN_HPP
+#define NAMED_TYPE_SPAN_HPP
+
+#include "named_type_impl.hpp"
+
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+// Zero-copy views between contiguous ranges of strong types and contiguous ranges of their underlying type:
+//
+//     std::vector<Meter> meters = ...;
+//     std::span<unsigned long long const> raw = fluent::as_underlying_span(std::as_const(meters));
+//     std::span<Meter const> strong = fluent::as_named_span<Meter>(raw);
+//
+// They are available only for strong types that have exactly the layout of their underlying type.
+
+namespace fluent
+{
+
+// The strong type is standard-layout, holds its underlying value by value,
+// and its skills add neither size (see FLUENT_EBCO) nor alignment.
+template <typename NamedType_>
+concept UnderlyingLayoutCompatible = details::IsNamedType<NamedType_>
+                                  && !std::is_reference<typename NamedType_::UnderlyingType>::value
+                                  && std::is_standard_layout<NamedType_>::value
+                                  && sizeof(NamedType_) == sizeof(typename NamedType_::UnderlyingType)
+                                  && alignof(NamedType_) == alignof(typename NamedType_::UnderlyingType);
+
+namespace details
+{
+template <typename NamedType_>
+constexpr void checkUnderlyingLayout()
+{
+    using T = typename NamedType_::UnderlyingType;
+    static_assert(!std::is_reference<T>::value, "strong references can't be viewed as an array of their underlying type");
+    static_assert(std::is_standard_layout<NamedType_>::value, "the strong type must be standard-layout");
+    static_assert(sizeof(NamedType_) == sizeof(T), "the skills add padding to the strong type, is FLUENT_EBCO enabled?");
+    static_assert(alignof(NamedType_) == alignof(T), "the strong type and its underlying type must have the same alignment");
+}
+
+template <typename From, typename To>
+using copy_const_t = std::conditional_t<std::is_const<From>::value, To const, To>;
+
+template <typename Range>
+using range_element_t = std::remove_reference_t<std::ranges::range_reference_t<Range>>;
+} // namespace details
+
+template <typename Range>
+    requires std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range> && std::ranges::borrowed_range<Range>
+          && details::IsNamedType<std::remove_cv_t<details::range_element_t<Range>>>
+FLUENT_NODISCARD auto as_underlying_span(Range&& range) noexcept
+{
+    using Element = details::range_element_t<Range>;
+    using NamedType_ = std::remove_cv_t<Element>;
+    details::checkUnderlyingLayout<NamedType_>();
+
+    using Underlying = details::copy_const_t<Element, typename NamedType_::UnderlyingType>;
+    return std::span<Underlying>(reinterpret_cast<Underlying*>(std::ranges::data(range)), std::ranges::size(range));
+}
+
+template <typename NamedType_, typename Range>
+    requires std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range> && std::ranges::borrowed_range<Range>
+          && details::IsNamedType<NamedType_>
+FLUENT_NODISCARD auto as_named_span(Range&& range) noexcept
+{
+    using Element = details::range_element_t<Range>;
+    static_assert(std::is_same<std::remove_cv_t<Element>, typename NamedType_::UnderlyingType>::value,
+                  "the range must contain values of the underlying type");
+    details::checkUnderlyingLayout<NamedType_>();
+
+    using Strong = details::copy_const_t<Element, NamedType_>;
+    return std::span<Strong>(reinterpret_cast<Strong*>(std::ranges::data(range)), std::ranges::size(range));
+}
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,203 @@
+#ifndef NAMED_TYPE_STRONG_VECTOR_HPP
+#define NAMED_TYPE_STRONG_VECTOR_HPP
+
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fluent
+{
+
+// A strong type over an integer, that can be used as an index.
+template <typename Index>
+concept StrongIndex = details::IsNamedType<Index> && std::is_integral<typename Index::UnderlyingType>::value;
+
+// A std::vector that can only be indexed by the strong type Index, to use dense arrays in place of maps
+// keyed by strong identifiers:
+//
+//     using NodeId = NamedType<uint32_t, struct NodeIdTag, Comparable>;
+//     strong_vector<NodeId, Node> nodes;
+//     NodeId id = nodes.next_index();
+//     nodes.push_back(node);
+//     nodes[id].visit();
+template <StrongIndex Index, typename Value, typename Allocator = std::allocator<Value>>
+class strong_vector
+{
+public:
+    using index_type = Index;
+    using value_type = Value;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using reference = Value&;
+    using const_reference = Value const&;
+    using iterator = typename std::vector<Value, Allocator>::iterator;
+    using const_iterator = typename std::vector<Value, Allocator>::const_iterator;
+
+    strong_vector() = default;
+    explicit strong_vector(Allocator const& allocator) : values_(allocator)
+    {
+    }
+    explicit strong_vector(size_type size, Allocator const& allocator = Allocator()) : values_(size, allocator)
+    {
+    }
+    strong_vector(size_type size, Value const& value, Allocator const& allocator = Allocator()) : values_(size, value, allocator)
+    {
+    }
+    strong_vector(std::initializer_list<Value> values, Allocator const& allocator = Allocator()) : values_(values, allocator)
+    {
+    }
+    explicit strong_vector(std::vector<Value, Allocator> values) : values_(std::move(values))
+    {
+    }
+
+    FLUENT_NODISCARD reference operator[](Index index) noexcept
+    {
+        return values_[position(index)];
+    }
+    FLUENT_NODISCARD const_reference operator[](Index index) const noexcept
+    {
+        return values_[position(index)];
+    }
+
+    // Throws std::out_of_range if index is not in the vector.
+    FLUENT_NODISCARD reference at(Index index)
+    {
+        return values_.at(position(index));
+    }
+    FLUENT_NODISCARD const_reference at(Index index) const
+    {
+        return values_.at(position(index));
+    }
+
+    FLUENT_NODISCARD bool contains(Index index) const noexcept
+    {
+        if constexpr (std::is_signed<typename Index::UnderlyingType>::value)
+        {
+            if (index.get() < 0)
+            {
+                return false;
+            }
+        }
+        return position(index) < values_.size();
+    }
+
+    // The index of the next element that will be pushed back.
+    FLUENT_NODISCARD Index next_index() const noexcept
+    {
+        return Index(static_cast<typename Index::UnderlyingType>(values_.size()));
+    }
+
+    FLUENT_NODISCARD size_type size() const noexcept
+    {
+        return values_.size();
+    }
+    FLUENT_NODISCARD bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+    void reserve(size_type capacity)
+    {
+        values_.reserve(capacity);
+    }
+    void resize(size_type size)
+    {
+        values_.resize(size);
+    }
+    void resize(size_type size, Value const& value)
+    {
+        values_.resize(size, value);
+    }
+    void clear() noexcept
+    {
+        values_.clear();
+    }
+
+    void push_back(Value const& value)
+    {
+        values_.push_back(value);
+    }
+    void push_back(Value&& value)
+    {
+        values_.push_back(std::move(value));
+    }
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        return values_.emplace_back(std::forward<Args>(args)...);
+    }
+    void pop_back() noexcept
+    {
+        values_.pop_back();
+    }
+
+    FLUENT_NODISCARD reference front() noexcept
+    {
+        return values_.front();
+    }
+    FLUENT_NODISCARD const_reference front() const noexcept
+    {
+        return values_.front();
+    }
+    FLUENT_NODISCARD reference back() noexcept
+    {
+        return values_.back();
+    }
+    FLUENT_NODISCARD const_reference back() const noexcept
+    {
+        return values_.back();
+    }
+
+    FLUENT_NODISCARD Value* data() noexcept
+    {
+        return values_.data();
+    }
+    FLUENT_NODISCARD Value const* data() const noexcept
+    {
+        return values_.data();
+    }
+
+    FLUENT_NODISCARD iterator begin() noexcept
+    {
+        return values_.begin();
+    }
+    FLUENT_NODISCARD const_iterator begin() const noexcept
+    {
+        return values_.begin();
+    }
+    FLUENT_NODISCARD iterator end() noexcept
+    {
+        return values_.end();
+    }
+    FLUENT_NODISCARD const_iterator end() const noexcept
+    {
+        return values_.end();
+    }
+
+    // The underlying std::vector, indexed by integers.
+    FLUENT_NODISCARD std::vector<Value, Allocator> const& underlying() const noexcept
+    {
+        return values_;
+    }
+
+    FLUENT_NODISCARD friend bool operator==(strong_vector const& left, strong_vector const& right)
+    {
+        return left.values_ == right.values_;
+    }
+
+private:
+    static constexpr size_type position(Index index) noexcept
+    {
+        return static_cast<size_type>(index.get());
+    }
+
+    std::vector<Value, Allocator> values_{};
+};
+
+} // namespace fluent
+
+#endif
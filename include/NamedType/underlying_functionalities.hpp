@@ -4,31 +4,63 @@
 #include "crtp.hpp"
 #include "named_type_impl.hpp"
 
+#include <cassert>
+#include <charconv>
+#include <compare>
+#include <concepts>
+#include <cstdlib>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 #if FLUENT_HOSTED == 1
 #   include <iostream>
+#   include <stdexcept>
 #endif
 
-// C++17 constexpr additions
-#if FLUENT_CPP17_PRESENT
-#    define FLUENT_CONSTEXPR17 constexpr
-#else
-#    define FLUENT_CONSTEXPR17 
+#ifndef FLUENT_HAS_OVERFLOW_BUILTINS
+#    if defined(__GNUC__) || defined(__clang__)
+#        define FLUENT_HAS_OVERFLOW_BUILTINS 1
+#    else
+#        define FLUENT_HAS_OVERFLOW_BUILTINS 0
+#    endif
 #endif
 
+
 namespace fluent
 {
 
+namespace details
+{
+// Lets the binary skills steal the storage of an expiring operand, so that chained expressions
+// such as a + b + c reuse the buffer of the first temporary. Strong references are never moved from.
+template <typename NamedType_>
+FLUENT_ALWAYS_INLINE constexpr decltype(auto) move_underlying(NamedType_& object) noexcept
+{
+    if constexpr (std::is_reference<typename NamedType_::UnderlyingType>::value)
+    {
+        return (object.get());
+    }
+    else
+    {
+        return static_cast<typename NamedType_::UnderlyingType&&>(object.get());
+    }
+}
+} // namespace details
+
 template <typename T>
 struct PreIncrementable : crtp<T, PreIncrementable>
 {
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
-    FLUENT_CONSTEXPR17 T& operator++()
+    FLUENT_ALWAYS_INLINE constexpr T& operator++()
     {
         ++this->underlying().get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 
@@ -40,9 +72,23 @@ struct PostIncrementable : crtp<T, PostIncrementable>
 {
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
-    FLUENT_CONSTEXPR17 T operator++(int)
+    // The value returned by the underlying post-increment is moved into the result. Underlying types
+    // that only have a pre-increment are copied before being incremented.
+    FLUENT_ALWAYS_INLINE constexpr T operator++(int)
     {
-        return T(this->underlying().get()++);
+        if constexpr (requires(typename T::UnderlyingType& value) { value++; })
+        {
+            T old(this->underlying().get()++);
+            FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
+            return old;
+        }
+        else
+        {
+            T old = this->underlying();
+            ++this->underlying().get();
+            FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
+            return old;
+        }
     }
 
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_END
@@ -53,9 +99,10 @@ struct PreDecrementable : crtp<T, PreDecrementable>
 {
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
-    FLUENT_CONSTEXPR17 T& operator--()
+    FLUENT_ALWAYS_INLINE constexpr T& operator--()
     {
         --this->underlying().get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 
@@ -67,9 +114,21 @@ struct PostDecrementable : crtp<T, PostDecrementable>
 {
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
-    FLUENT_CONSTEXPR17 T operator--(int)
+    FLUENT_ALWAYS_INLINE constexpr T operator--(int)
     {
-        return T( this->underlying().get()-- );
+        if constexpr (requires(typename T::UnderlyingType& value) { value--; })
+        {
+            T old(this->underlying().get()--);
+            FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
+            return old;
+        }
+        else
+        {
+            T old = this->underlying();
+            --this->underlying().get();
+            FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
+            return old;
+        }
     }
 
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_END
@@ -78,13 +137,31 @@ struct PostDecrementable : crtp<T, PostDecrementable>
 template <typename T>
 struct BinaryAddable : crtp<T, BinaryAddable>
 {
-    FLUENT_NODISCARD constexpr T operator+(T const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator+(T const& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         return T(this->underlying().get() + other.get());
     }
-    FLUENT_CONSTEXPR17 T& operator+=(T const& other)
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator+(T&& other) const&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(this->underlying().get() + details::move_underlying(other));
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator+(T const& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) + other.get());
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator+(T&& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) + details::move_underlying(other));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator+=(T const& other)
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         this->underlying().get() += other.get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 };
@@ -92,7 +169,7 @@ struct BinaryAddable : crtp<T, BinaryAddable>
 template <typename T>
 struct UnaryAddable : crtp<T, UnaryAddable>
 {
-    FLUENT_NODISCARD constexpr T operator+() const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator+() const
     {
         return T(+this->underlying().get());
     }
@@ -110,13 +187,31 @@ struct FLUENT_EBCO Addable
 template <typename T>
 struct BinarySubtractable : crtp<T, BinarySubtractable>
 {
-    FLUENT_NODISCARD constexpr T operator-(T const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator-(T const& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         return T(this->underlying().get() - other.get());
     }
-    FLUENT_CONSTEXPR17 T& operator-=(T const& other)
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator-(T&& other) const&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(this->underlying().get() - details::move_underlying(other));
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator-(T const& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) - other.get());
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator-(T&& other) &&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) - details::move_underlying(other));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator-=(T const& other)
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         this->underlying().get() -= other.get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 };
@@ -124,7 +219,7 @@ struct BinarySubtractable : crtp<T, BinarySubtractable>
 template <typename T>
 struct UnarySubtractable : crtp<T, UnarySubtractable>
 {
-    FLUENT_NODISCARD constexpr T operator-() const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator-() const
     {
         return T(-this->underlying().get());
     }
@@ -142,13 +237,31 @@ struct FLUENT_EBCO Subtractable
 template <typename T>
 struct Multiplicable : crtp<T, Multiplicable>
 {
-    FLUENT_NODISCARD constexpr T operator*(T const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator*(T const& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         return T(this->underlying().get() * other.get());
     }
-    FLUENT_CONSTEXPR17 T& operator*=(T const& other)
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator*(T&& other) const&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(this->underlying().get() * details::move_underlying(other));
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator*(T const& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) * other.get());
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator*(T&& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) * details::move_underlying(other));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator*=(T const& other)
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         this->underlying().get() *= other.get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 };
@@ -156,27 +269,207 @@ struct Multiplicable : crtp<T, Multiplicable>
 template <typename T>
 struct Divisible : crtp<T, Divisible>
 {
-    FLUENT_NODISCARD constexpr T operator/(T const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator/(T const& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         return T(this->underlying().get() / other.get());
     }
-    FLUENT_CONSTEXPR17 T& operator/=(T const& other)
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator/(T&& other) const&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(this->underlying().get() / details::move_underlying(other));
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator/(T const& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) / other.get());
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator/(T&& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) / details::move_underlying(other));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator/=(T const& other)
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         this->underlying().get() /= other.get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
+        return this->underlying();
+    }
+};
+
+namespace details
+{
+template <typename I>
+concept SaturableInteger = std::is_integral<I>::value && !std::is_same<I, bool>::value;
+
+// The saturating operations are written without branches: the unsigned ones as plain arithmetic that
+// compilers turn into saturating vector instructions (such as paddus/psubus) in loops.
+template <SaturableInteger I>
+constexpr I saturatingAdd(I left, I right) noexcept
+{
+    if constexpr (std::is_unsigned<I>::value)
+    {
+        auto const sum = static_cast<I>(left + right);
+        return static_cast<I>(sum | static_cast<I>(-static_cast<I>(sum < left)));
+    }
+    else
+    {
+        using Unsigned = std::make_unsigned_t<I>;
+        I sum{};
+#if FLUENT_HAS_OVERFLOW_BUILTINS
+        bool const overflow = __builtin_add_overflow(left, right, &sum);
+#else
+        sum = static_cast<I>(static_cast<Unsigned>(static_cast<Unsigned>(left) + static_cast<Unsigned>(right)));
+        bool const overflow = ((left ^ sum) & (right ^ sum)) < 0;
+#endif
+        // The overflow goes towards the sign of left: max, or max + 1 == min if left is negative.
+        auto const limit = static_cast<I>(static_cast<Unsigned>(std::numeric_limits<I>::max()) + static_cast<Unsigned>(left < 0));
+        return overflow ? limit : sum;
+    }
+}
+
+template <SaturableInteger I>
+constexpr I saturatingSubtract(I left, I right) noexcept
+{
+    if constexpr (std::is_unsigned<I>::value)
+    {
+        auto const difference = static_cast<I>(left - right);
+        return static_cast<I>(difference & static_cast<I>(-static_cast<I>(difference <= left)));
+    }
+    else
+    {
+        using Unsigned = std::make_unsigned_t<I>;
+        I difference{};
+#if FLUENT_HAS_OVERFLOW_BUILTINS
+        bool const overflow = __builtin_sub_overflow(left, right, &difference);
+#else
+        difference = static_cast<I>(static_cast<Unsigned>(static_cast<Unsigned>(left) - static_cast<Unsigned>(right)));
+        bool const overflow = ((left ^ right) & (left ^ difference)) < 0;
+#endif
+        auto const limit = static_cast<I>(static_cast<Unsigned>(std::numeric_limits<I>::max()) + static_cast<Unsigned>(left < 0));
+        return overflow ? limit : difference;
+    }
+}
+
+// Returns true if left * right overflows I, and stores the wrapped product in result.
+template <SaturableInteger I>
+constexpr bool multiplyOverflows(I left, I right, I& result) noexcept
+{
+#if FLUENT_HAS_OVERFLOW_BUILTINS
+    return __builtin_mul_overflow(left, right, &result);
+#else
+    if constexpr (std::is_unsigned<I>::value)
+    {
+        result = static_cast<I>(left * right);
+        return left != 0 && result / left != right;
+    }
+    else
+    {
+        using Unsigned = std::make_unsigned_t<I>;
+        result = static_cast<I>(static_cast<Unsigned>(static_cast<Unsigned>(left) * static_cast<Unsigned>(right)));
+        if (left == 0 || right == 0)
+        {
+            return false;
+        }
+        if ((left == -1 && right == std::numeric_limits<I>::min()) || (right == -1 && left == std::numeric_limits<I>::min()))
+        {
+            return true;
+        }
+        return result / left != right;
+    }
+#endif
+}
+} // namespace details
+
+// Addition and subtraction that clamp to the limits of the underlying integer type instead of wrapping.
+// Not meant to be combined with Addable or Subtractable.
+template <typename T>
+struct SaturatingAddable : crtp<T, SaturatingAddable>
+{
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator+(T const& other) const noexcept(details::isNothrowValidated<T>())
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::saturatingAdd(this->underlying().get(), other.get()));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator+=(T const& other) noexcept(details::isNothrowValidated<T>())
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        this->underlying().get() = details::saturatingAdd(this->underlying().get(), other.get());
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 };
 
+template <typename T>
+struct SaturatingSubtractable : crtp<T, SaturatingSubtractable>
+{
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator-(T const& other) const noexcept(details::isNothrowValidated<T>())
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::saturatingSubtract(this->underlying().get(), other.get()));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator-=(T const& other) noexcept(details::isNothrowValidated<T>())
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        this->underlying().get() = details::saturatingSubtract(this->underlying().get(), other.get());
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
+        return this->underlying();
+    }
+};
+
+#if FLUENT_HOSTED == 1
+// Multiplication that throws std::overflow_error if the product does not fit in the underlying integer type.
+// Not meant to be combined with Multiplicable.
+template <typename T>
+struct CheckedMultiplicable : crtp<T, CheckedMultiplicable>
+{
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator*(T const& other) const
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        auto product = typename T::UnderlyingType{};
+        if (details::multiplyOverflows(this->underlying().get(), other.get(), product))
+        {
+            throw std::overflow_error("overflow in the multiplication of a strong type");
+        }
+        return T(product);
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator*=(T const& other)
+    {
+        this->underlying() = this->underlying() * other;
+        return this->underlying();
+    }
+};
+#endif
+
 template <typename T>
 struct Modulable : crtp<T, Modulable>
 {
-    FLUENT_NODISCARD constexpr T operator%(T const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator%(T const& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         return T(this->underlying().get() % other.get());
     }
-    FLUENT_CONSTEXPR17 T& operator%=(T const& other)
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator%(T&& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(this->underlying().get() % details::move_underlying(other));
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator%(T const& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) % other.get());
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator%(T&& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) % details::move_underlying(other));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator%=(T const& other)
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         this->underlying().get() %= other.get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 };
@@ -184,7 +477,7 @@ struct Modulable : crtp<T, Modulable>
 template <typename T>
 struct BitWiseInvertable : crtp<T, BitWiseInvertable>
 {
-    FLUENT_NODISCARD constexpr T operator~() const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator~() const
     {
         return T(~this->underlying().get());
     }
@@ -193,13 +486,31 @@ struct BitWiseInvertable : crtp<T, BitWiseInvertable>
 template <typename T>
 struct BitWiseAndable : crtp<T, BitWiseAndable>
 {
-    FLUENT_NODISCARD constexpr T operator&(T const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator&(T const& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         return T(this->underlying().get() & other.get());
     }
-    FLUENT_CONSTEXPR17 T& operator&=(T const& other)
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator&(T&& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(this->underlying().get() & details::move_underlying(other));
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator&(T const& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) & other.get());
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator&(T&& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) & details::move_underlying(other));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator&=(T const& other)
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         this->underlying().get() &= other.get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 };
@@ -207,13 +518,31 @@ struct BitWiseAndable : crtp<T, BitWiseAndable>
 template <typename T>
 struct BitWiseOrable : crtp<T, BitWiseOrable>
 {
-    FLUENT_NODISCARD constexpr T operator|(T const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator|(T const& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         return T(this->underlying().get() | other.get());
     }
-    FLUENT_CONSTEXPR17 T& operator|=(T const& other)
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator|(T&& other) const&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(this->underlying().get() | details::move_underlying(other));
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator|(T const& other) &&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) | other.get());
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator|(T&& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) | details::move_underlying(other));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator|=(T const& other)
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         this->underlying().get() |= other.get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 };
@@ -221,13 +550,31 @@ struct BitWiseOrable : crtp<T, BitWiseOrable>
 template <typename T>
 struct BitWiseXorable : crtp<T, BitWiseXorable>
 {
-    FLUENT_NODISCARD constexpr T operator^(T const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator^(T const& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         return T(this->underlying().get() ^ other.get());
     }
-    FLUENT_CONSTEXPR17 T& operator^=(T const& other)
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator^(T&& other) const&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(this->underlying().get() ^ details::move_underlying(other));
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator^(T const& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) ^ other.get());
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator^(T&& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) ^ details::move_underlying(other));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator^=(T const& other)
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         this->underlying().get() ^= other.get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 };
@@ -235,13 +582,31 @@ struct BitWiseXorable : crtp<T, BitWiseXorable>
 template <typename T>
 struct BitWiseLeftShiftable : crtp<T, BitWiseLeftShiftable>
 {
-    FLUENT_NODISCARD constexpr T operator<<(T const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator<<(T const& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         return T(this->underlying().get() << other.get());
     }
-    FLUENT_CONSTEXPR17 T& operator<<=(T const& other)
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator<<(T&& other) const&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(this->underlying().get() << details::move_underlying(other));
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator<<(T const& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) << other.get());
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator<<(T&& other) &&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) << details::move_underlying(other));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator<<=(T const& other)
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         this->underlying().get() <<= other.get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 };
@@ -249,44 +614,230 @@ struct BitWiseLeftShiftable : crtp<T, BitWiseLeftShiftable>
 template <typename T>
 struct BitWiseRightShiftable : crtp<T, BitWiseRightShiftable>
 {
-    FLUENT_NODISCARD constexpr T operator>>(T const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator>>(T const& other) const&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         return T(this->underlying().get() >> other.get());
     }
-    FLUENT_CONSTEXPR17 T& operator>>=(T const& other)
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator>>(T&& other) const&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(this->underlying().get() >> details::move_underlying(other));
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator>>(T const& other) &&
     {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) >> other.get());
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T operator>>(T&& other) &&
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+        return T(details::move_underlying(this->underlying()) >> details::move_underlying(other));
+    }
+    FLUENT_ALWAYS_INLINE constexpr T& operator>>=(T const& other)
+    {
+        FLUENT_INSTRUMENT_EVENT(T, binary_operation);
         this->underlying().get() >>= other.get();
+        FLUENT_VALIDATE_INVARIANT(T, this->underlying().get());
         return this->underlying();
     }
 };
 
+// Operators between a strong type and a value of another type. They are hidden friends, so they combine
+// with the skills that take an operand of the strong type itself, such as Multiplicable or BinarySubtractable.
+
+// Multiplies and divides the strong type by a Scalar, such as a factor of type double:
+//
+//     using Price = NamedType<double, struct PriceTag, Addable, ScalableBy<double>::templ>;
+//     Price discounted = price * 0.9;
+template <typename Scalar>
+struct ScalableBy
+{
+    template <typename T>
+    struct templ : crtp<T, templ>
+    {
+        FLUENT_NODISCARD FLUENT_ALWAYS_INLINE friend constexpr T operator*(T const& value, Scalar const& factor)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            return T(value.get() * factor);
+        }
+        FLUENT_NODISCARD FLUENT_ALWAYS_INLINE friend constexpr T operator*(Scalar const& factor, T const& value)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            return T(factor * value.get());
+        }
+        FLUENT_NODISCARD FLUENT_ALWAYS_INLINE friend constexpr T operator/(T const& value, Scalar const& divisor)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            return T(value.get() / divisor);
+        }
+        FLUENT_ALWAYS_INLINE friend constexpr T& operator*=(T& value, Scalar const& factor)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            value.get() *= factor;
+            FLUENT_VALIDATE_INVARIANT(T, value.get());
+            return value;
+        }
+        FLUENT_ALWAYS_INLINE friend constexpr T& operator/=(T& value, Scalar const& divisor)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            value.get() /= divisor;
+            FLUENT_VALIDATE_INVARIANT(T, value.get());
+            return value;
+        }
+    };
+};
+
+// Shifts the bits of the strong type by an amount of type Shift:
+//
+//     using Bitmask = NamedType<uint64_t, struct BitmaskTag, BitWiseOrable, ShiftableBy<int>::templ>;
+//     Bitmask next = mask << 1;
+template <typename Shift>
+struct ShiftableBy
+{
+    template <typename T>
+    struct templ : crtp<T, templ>
+    {
+        FLUENT_NODISCARD FLUENT_ALWAYS_INLINE friend constexpr T operator<<(T const& value, Shift const& shift)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            return T(value.get() << shift);
+        }
+        FLUENT_NODISCARD FLUENT_ALWAYS_INLINE friend constexpr T operator>>(T const& value, Shift const& shift)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            return T(value.get() >> shift);
+        }
+        FLUENT_ALWAYS_INLINE friend constexpr T& operator<<=(T& value, Shift const& shift)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            value.get() <<= shift;
+            FLUENT_VALIDATE_INVARIANT(T, value.get());
+            return value;
+        }
+        FLUENT_ALWAYS_INLINE friend constexpr T& operator>>=(T& value, Shift const& shift)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            value.get() >>= shift;
+            FLUENT_VALIDATE_INVARIANT(T, value.get());
+            return value;
+        }
+    };
+};
+
+namespace details
+{
+template <typename Value>
+FLUENT_ALWAYS_INLINE constexpr decltype(auto) underlyingOf(Value const& value) noexcept
+{
+    if constexpr (IsNamedType<Value>)
+    {
+        return value.get();
+    }
+    else
+    {
+        return (value);
+    }
+}
+} // namespace details
+
+// Makes the strong type the points of an affine space, whose differences are of type Delta, a strong type
+// or a plain type. Points can be offset by a Delta, and subtracting two points gives a Delta, but points
+// cannot be added together:
+//
+//     using Duration = NamedType<int64_t, struct DurationTag, Addable, Comparable>;
+//     using TimePoint = NamedType<int64_t, struct TimePointTag, Comparable, OffsetBy<Duration>::templ>;
+//     Duration elapsed = end - start;
+//     TimePoint deadline = start + Duration(100);
+template <typename Delta>
+struct OffsetBy
+{
+    template <typename T>
+    struct templ : crtp<T, templ>
+    {
+        FLUENT_NODISCARD FLUENT_ALWAYS_INLINE friend constexpr T operator+(T const& point, Delta const& delta)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            return T(point.get() + details::underlyingOf(delta));
+        }
+        FLUENT_NODISCARD FLUENT_ALWAYS_INLINE friend constexpr T operator+(Delta const& delta, T const& point)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            return T(details::underlyingOf(delta) + point.get());
+        }
+        FLUENT_NODISCARD FLUENT_ALWAYS_INLINE friend constexpr T operator-(T const& point, Delta const& delta)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            return T(point.get() - details::underlyingOf(delta));
+        }
+        FLUENT_NODISCARD FLUENT_ALWAYS_INLINE friend constexpr Delta operator-(T const& left, T const& right)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            return Delta(left.get() - right.get());
+        }
+        FLUENT_ALWAYS_INLINE friend constexpr T& operator+=(T& point, Delta const& delta)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            point.get() += details::underlyingOf(delta);
+            FLUENT_VALIDATE_INVARIANT(T, point.get());
+            return point;
+        }
+        FLUENT_ALWAYS_INLINE friend constexpr T& operator-=(T& point, Delta const& delta)
+        {
+            FLUENT_INSTRUMENT_EVENT(T, binary_operation);
+            point.get() -= details::underlyingOf(delta);
+            FLUENT_VALIDATE_INVARIANT(T, point.get());
+            return point;
+        }
+    };
+};
+
+namespace details
+{
+template <typename NamedType_>
+inline constexpr bool isNothrowLessComparable = noexcept(std::declval<std::remove_reference_t<typename NamedType_::UnderlyingType> const&>()
+                                                         < std::declval<std::remove_reference_t<typename NamedType_::UnderlyingType> const&>());
+
+template <typename NamedType_>
+inline constexpr bool isNothrowEqualityComparable = noexcept(std::declval<std::remove_reference_t<typename NamedType_::UnderlyingType> const&>()
+                                                             == std::declval<std::remove_reference_t<typename NamedType_::UnderlyingType> const&>());
+} // namespace details
+
 template <typename T>
 struct Comparable : crtp<T, Comparable>
 {
-    FLUENT_NODISCARD constexpr bool operator<(Comparable<T> const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr bool operator<(Comparable<T> const& other) const noexcept(details::isNothrowLessComparable<T>)
     {
         return this->underlying().get() < other.underlying().get();
     }
-    FLUENT_NODISCARD constexpr bool operator>(Comparable<T> const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr bool operator>(Comparable<T> const& other) const noexcept(details::isNothrowLessComparable<T>)
     {
         return other.underlying().get() < this->underlying().get();
     }
-    FLUENT_NODISCARD constexpr bool operator<=(Comparable<T> const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr bool operator<=(Comparable<T> const& other) const noexcept(details::isNothrowLessComparable<T>)
     {
         return !(other < *this);
     }
-    FLUENT_NODISCARD constexpr bool operator>=(Comparable<T> const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr bool operator>=(Comparable<T> const& other) const noexcept(details::isNothrowLessComparable<T>)
     {
         return !(*this < other);
     }
-    FLUENT_NODISCARD constexpr bool operator==(Comparable<T> const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr bool operator==(Comparable<T> const& other) const noexcept(details::isNothrowEqualityComparable<T>)
     {
         return this->underlying().get() == other.underlying().get();
     }
-    FLUENT_NODISCARD constexpr bool operator!=(Comparable<T> const& other) const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr bool operator!=(Comparable<T> const& other) const noexcept(details::isNothrowEqualityComparable<T>)
     {
         return !(*this == other);
     }
+    // Only for underlying types that have a three-way comparison. It is a template so that a < b still calls
+    // the operator< above rather than the more constrained rewritten candidate (a <=> b) < 0.
+    template <typename Self = T>
+        requires std::is_same<Self, T>::value && std::three_way_comparable<std::remove_reference_t<typename Self::UnderlyingType>>
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr auto operator<=>(Comparable<Self> const& other) const
+    {
+        return this->underlying().get() <=> other.underlying().get();
+    }
 };
 
 template< typename T >
@@ -295,14 +846,22 @@ struct Dereferencable;
 template< typename T, typename Parameter, template< typename > class ... Skills >
 struct Dereferencable<NamedType<T, Parameter, Skills...>> : crtp<NamedType<T, Parameter, Skills...>, Dereferencable>
 {
-    FLUENT_NODISCARD constexpr T& operator*() &
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T& operator*() &
     {
         return this->underlying().get();
     }
-    FLUENT_NODISCARD constexpr std::remove_reference_t<T> const& operator*() const &
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr std::remove_reference_t<T> const& operator*() const &
     {
         return this->underlying().get();
     }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr T&& operator*() &&
+    {
+        return std::move(this->underlying()).get();
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr decltype(auto) operator*() const&&
+    {
+        return std::move(this->underlying()).get();
+    }
 };
 
 template <typename Destination>
@@ -311,13 +870,185 @@ struct ImplicitlyConvertibleTo
     template <typename T>
     struct templ : crtp<T, templ>
     {
-        FLUENT_NODISCARD constexpr operator Destination() const
+        FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr operator Destination() const
         {
             return this->underlying().get();
         }
     };
 };
 
+// Counts the operations on the strong type when FLUENT_INSTRUMENT is 1, see instrumentation.hpp.
+template <typename T>
+struct Instrumented
+{
+    static constexpr bool is_instrumented = true;
+};
+
+// What to do with a value that breaks the invariant of a Validated strong type. A policy has a static function
+// apply(predicate, value), that may change the value, and tells in is_nothrow whether apply can throw.
+// It can also have a static function apply_at_boundary(predicate, value), used instead of apply for the values
+// that come from outside the program.
+namespace validation
+{
+// Asserts inside the program. The values that come from outside it abort the program even if NDEBUG is defined.
+struct assert_valid
+{
+    static constexpr bool is_nothrow = true;
+
+    template <typename Predicate, typename Value>
+    FLUENT_ALWAYS_INLINE static constexpr void apply([[maybe_unused]] Predicate const& predicate, [[maybe_unused]] Value& value) noexcept
+    {
+        assert(predicate(value) && "the invariant of a strong type is broken");
+    }
+
+    template <typename Predicate, typename Value>
+    FLUENT_ALWAYS_INLINE static constexpr void apply_at_boundary(Predicate const& predicate, Value& value) noexcept
+    {
+        if (!predicate(value))
+        {
+            assert(false && "the invariant of a strong type is broken");
+            std::abort();
+        }
+    }
+};
+
+#if FLUENT_HOSTED == 1
+struct throw_if_invalid
+{
+    static constexpr bool is_nothrow = false;
+
+    template <typename Predicate, typename Value>
+    FLUENT_ALWAYS_INLINE static constexpr void apply(Predicate const& predicate, Value& value)
+    {
+        if (!predicate(value))
+        {
+            throw std::invalid_argument("the invariant of a strong type is broken");
+        }
+    }
+};
+#endif
+
+// Replaces the value by the nearest valid one, given by predicate.clamp(value).
+struct clamp_to_valid
+{
+    static constexpr bool is_nothrow = true;
+
+    template <typename Predicate, typename Value>
+    FLUENT_ALWAYS_INLINE static constexpr void apply(Predicate const& predicate, Value& value) noexcept
+    {
+        if (!predicate(value))
+        {
+            value = predicate.clamp(value);
+        }
+    }
+};
+
+// Documents the invariant without checking it, for instance on a hot path whose inputs are already validated.
+struct skip
+{
+    static constexpr bool is_nothrow = true;
+
+    template <typename Predicate, typename Value>
+    FLUENT_ALWAYS_INLINE static constexpr void apply(Predicate const&, Value&) noexcept
+    {
+    }
+};
+} // namespace validation
+
+namespace details
+{
+template <typename Left, typename Right>
+FLUENT_ALWAYS_INLINE constexpr bool isLess(Left const& left, Right const& right)
+{
+    if constexpr (std::is_integral<Left>::value && std::is_integral<Right>::value && !std::is_same<Left, bool>::value
+                  && !std::is_same<Right, bool>::value)
+    {
+        return std::cmp_less(left, right);
+    }
+    else
+    {
+        return left < right;
+    }
+}
+} // namespace details
+
+// The values between Min and Max included. Integers of different signedness are compared by their values.
+template <auto Min, auto Max>
+struct in_range
+{
+    template <typename Value>
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr bool operator()(Value const& value) const
+    {
+        return !details::isLess(value, Min) && !details::isLess(Max, value);
+    }
+
+    template <typename Value>
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr Value clamp(Value const& value) const
+    {
+        if (details::isLess(value, Min))
+        {
+            return Value{Min};
+        }
+        if (details::isLess(Max, value))
+        {
+            return Value{Max};
+        }
+        return value;
+    }
+};
+
+// Checks that the underlying value satisfies Predicate, a default constructible function object, when the strong
+// type is constructed and after each of its mutating operators, and applies Policy to the values that do not:
+//
+//     using Percentage = NamedType<int, struct PercentageTag, Addable, Validated<in_range<0, 100>>::templ>;
+//     Percentage p(150);                                // asserts
+//     Percentage q(fluent::unchecked, value);           // does not check
+//     Percentage r = Percentage::validated(userInput);  // checks even when FLUENT_VALIDATE is 0 or NDEBUG is defined
+//
+// The checks are elided when FLUENT_VALIDATE is 0, which is the default if NDEBUG is defined, except those of
+// validated(), from_chars and deserialize, whose values come from outside the program. The values modified
+// through get() are not checked.
+template <typename Predicate, typename Policy = validation::assert_valid>
+struct Validated
+{
+    template <typename T>
+    struct templ
+    {
+        static constexpr bool is_validated = true;
+        static constexpr bool is_nothrow_validated = Policy::is_nothrow;
+
+        template <typename Value>
+        FLUENT_ALWAYS_INLINE static constexpr void check_invariant(Value& value) noexcept(Policy::is_nothrow)
+        {
+            Policy::apply(Predicate{}, value);
+        }
+
+        template <typename Value>
+        FLUENT_ALWAYS_INLINE static constexpr void check_at_boundary(Value& value) noexcept(Policy::is_nothrow)
+        {
+            if constexpr (requires { Policy::apply_at_boundary(Predicate{}, value); })
+            {
+                Policy::apply_at_boundary(Predicate{}, value);
+            }
+            else
+            {
+                Policy::apply(Predicate{}, value);
+            }
+        }
+
+        // For the values that come from outside the program, such as user input. Like the constructor of
+        // the strong type, it rejects the narrowing conversions.
+        template <typename... Args>
+            requires NonNarrowingConstructible<typename T::UnderlyingType, Args...>
+        FLUENT_NODISCARD static constexpr T validated(Args&&... args)
+        {
+            typename T::UnderlyingType value{std::forward<Args>(args)...};
+            details::checkAtBoundary<T>(value);
+            return T(unchecked, std::move(value));
+        }
+    };
+};
+
 template <typename T>
 struct Printable : crtp<T, Printable>
 {
@@ -339,26 +1070,210 @@ struct Printable : crtp<T, Printable>
     }
 #endif
 
+// Formattable and Parsable convert arithmetic underlying values to and from text with std::to_chars and
+// std::from_chars: into and from a caller-provided buffer, with no locale, no allocation and no iostream.
+template <typename T>
+struct Formattable : crtp<T, Formattable>
+{
+    static constexpr bool is_formattable = true;
+
+    constexpr std::to_chars_result to_chars(char* first, char* last) const noexcept
+    {
+        return std::to_chars(first, last, this->underlying().get());
+    }
+
+    constexpr std::to_chars_result to_chars(char* first, char* last, int base) const noexcept
+        requires std::is_integral<typename T::UnderlyingType>::value
+    {
+        return std::to_chars(first, last, this->underlying().get(), base);
+    }
+
+    constexpr std::to_chars_result to_chars(char* first, char* last, std::chars_format format) const noexcept
+        requires std::is_floating_point<typename T::UnderlyingType>::value
+    {
+        return std::to_chars(first, last, this->underlying().get(), format);
+    }
+};
+
+template <typename T>
+struct Parsable : crtp<T, Parsable>
+{
+    static constexpr bool is_parsable = true;
+
+    // Like std::from_chars, the value is left unchanged if the text does not hold a number. The parsed values of
+    // a Validated strong type are checked even when FLUENT_VALIDATE is 0, since they come from outside the program.
+    constexpr std::from_chars_result from_chars(char const* first, char const* last) noexcept(details::isNothrowChecked<T>())
+    {
+        return parse([first, last](auto& value) noexcept { return std::from_chars(first, last, value); });
+    }
+
+    constexpr std::from_chars_result from_chars(char const* first, char const* last, int base) noexcept(details::isNothrowChecked<T>())
+        requires std::is_integral<typename T::UnderlyingType>::value
+    {
+        return parse([first, last, base](auto& value) noexcept { return std::from_chars(first, last, value, base); });
+    }
+
+    constexpr std::from_chars_result from_chars(char const* first, char const* last, std::chars_format format) noexcept(details::isNothrowChecked<T>())
+        requires std::is_floating_point<typename T::UnderlyingType>::value
+    {
+        return parse([first, last, format](auto& value) noexcept { return std::from_chars(first, last, value, format); });
+    }
+
+private:
+    template <typename Parse>
+    constexpr std::from_chars_result parse(Parse parseInto)
+    {
+        auto value = this->underlying().get();
+        auto const result = parseInto(value);
+        if (result.ec == std::errc{})
+        {
+            details::checkAtBoundary<T>(value);
+            this->underlying().get() = value;
+        }
+        return result;
+    }
+};
+
+// Hash policies, used by std::hash to hash the underlying value of a strong type.
+
+// Forwards to std::hash of the underlying type.
+struct StdHash
+{
+    template <typename U>
+    FLUENT_ALWAYS_INLINE constexpr size_t operator()(U const& value) const noexcept(noexcept(std::hash<U>()(value)))
+    {
+        return std::hash<U>()(value);
+    }
+};
+
+namespace details
+{
+// Finalizers of splitmix64 and murmur3, that spread every input bit over the whole hash.
+template <typename Size>
+constexpr Size mixBits(Size x) noexcept
+{
+    if constexpr (sizeof(Size) >= 8)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9U;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebU;
+        x ^= x >> 31;
+    }
+    else
+    {
+        x ^= x >> 16;
+        x *= 0x85ebca6bU;
+        x ^= x >> 13;
+        x *= 0xc2b2ae35U;
+        x ^= x >> 16;
+    }
+    return x;
+}
+} // namespace details
+
+// Mixes the result of std::hash, that is the identity for integers on common standard libraries.
+// Suited to open-addressing hash tables.
+struct MixedHash
+{
+    template <typename U>
+    FLUENT_ALWAYS_INLINE constexpr size_t operator()(U const& value) const noexcept(noexcept(std::hash<U>()(value)))
+    {
+        return details::mixBits(std::hash<U>()(value));
+    }
+};
+
 template <typename T>
 struct Hashable
 {
-    static constexpr bool is_hashable = true;
+};
+
+namespace details
+{
+template <typename Policy>
+struct HashPolicy
+{
+};
+
+template <typename Policy>
+Policy customHashPolicy(HashPolicy<Policy> const*);
+} // namespace details
+
+// Hashable with a custom hash policy, that is a function object taking the underlying value:
+//     using UserId = NamedType<uint64_t, struct UserIdTag, Comparable, HashableWith<MixedHash>::templ>;
+// It takes precedence over the StdHash of Hashable, so it can be combined with Arithmetic.
+template <typename Policy>
+struct HashableWith
+{
+    template <typename T>
+    struct templ : details::HashPolicy<Policy>
+    {
+    };
+};
+
+namespace details
+{
+// The hash policy of a strong type, given by HashableWith or else by Hashable. Not defined for types that are not hashable.
+template <typename NamedType_>
+struct hash_policy
+{
+};
+
+template <typename NamedType_>
+concept HasCustomHashPolicy = requires { customHashPolicy(std::declval<NamedType_ const*>()); };
+
+template <typename NamedType_>
+    requires(HasSkill<NamedType_, Hashable> && !HasCustomHashPolicy<NamedType_>)
+struct hash_policy<NamedType_>
+{
+    using type = StdHash;
 };
 
+template <typename NamedType_>
+    requires(HasCustomHashPolicy<NamedType_>)
+struct hash_policy<NamedType_>
+{
+    using type = decltype(customHashPolicy(std::declval<NamedType_ const*>()));
+};
+
+template <typename NamedType_>
+using hash_policy_t = typename hash_policy<NamedType_>::type;
+
+template <typename NamedType_>
+concept IsHashable = requires { typename hash_policy_t<NamedType_>; };
+} // namespace details
+
+// Hook for absl::Hash. absl hashes the underlying value with its own algorithm, the hash policy is only used by std::hash
+// and transparent_hash.
+template <typename H, typename NamedType_>
+    requires(details::IsHashable<NamedType_>)
+H AbslHashValue(H h, NamedType_ const& x)
+{
+    return H::combine(std::move(h), x.get());
+}
+
 template <typename NamedType_>
 struct FunctionCallable;
 
 template <typename T, typename Parameter, template <typename> class... Skills>
 struct FunctionCallable<NamedType<T, Parameter, Skills...>> : crtp<NamedType<T, Parameter, Skills...>, FunctionCallable>
 {
-    FLUENT_NODISCARD constexpr operator T const&() const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr operator T const&() const&
     {
         return this->underlying().get();
     }
-    FLUENT_NODISCARD constexpr operator T&()
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr operator T&() &
     {
         return this->underlying().get();
     }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr operator T&&() &&
+    {
+        return std::move(this->underlying()).get();
+    }
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr operator T const&&() const&&
+    {
+        return std::move(this->underlying()).get();
+    }
 };
 
 template <typename NamedType_>
@@ -367,11 +1282,11 @@ struct MethodCallable;
 template <typename T, typename Parameter, template <typename> class... Skills>
 struct MethodCallable<NamedType<T, Parameter, Skills...>> : crtp<NamedType<T, Parameter, Skills...>, MethodCallable>
 {
-    FLUENT_NODISCARD FLUENT_CONSTEXPR17 std::remove_reference_t<T> const* operator->() const
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr std::remove_reference_t<T> const* operator->() const
     {
         return std::addressof(this->underlying().get());
     }
-    FLUENT_NODISCARD FLUENT_CONSTEXPR17 std::remove_reference_t<T>* operator->()
+    FLUENT_NODISCARD FLUENT_ALWAYS_INLINE constexpr std::remove_reference_t<T>* operator->()
     {
         return std::addressof(this->underlying().get());
     }
@@ -402,12 +1317,19 @@ struct FLUENT_EBCO Decrementable
     using PreDecrementable<T>::operator--;
 };
 
+// Arithmetic derives directly from the elementary skills rather than from Incrementable, Addable, etc.,
+// to save the instantiation of the intermediate bundles. As a consequence, HasSkill<T, Addable> is false
+// for an Arithmetic T, while HasSkill<T, BinaryAddable> is true.
 template <typename T>
 struct FLUENT_EBCO Arithmetic
-    : Incrementable<T>
-    , Decrementable<T>
-    , Addable<T>
-    , Subtractable<T>
+    : PreIncrementable<T>
+    , PostIncrementable<T>
+    , PreDecrementable<T>
+    , PostDecrementable<T>
+    , BinaryAddable<T>
+    , UnaryAddable<T>
+    , BinarySubtractable<T>
+    , UnarySubtractable<T>
     , Multiplicable<T>
     , Divisible<T>
     , Modulable<T>
@@ -421,6 +1343,14 @@ struct FLUENT_EBCO Arithmetic
     , Printable<T>
     , Hashable<T>
 {
+    using PostIncrementable<T>::operator++;
+    using PreIncrementable<T>::operator++;
+    using PostDecrementable<T>::operator--;
+    using PreDecrementable<T>::operator--;
+    using BinaryAddable<T>::operator+;
+    using UnaryAddable<T>::operator+;
+    using BinarySubtractable<T>::operator-;
+    using UnarySubtractable<T>::operator-;
 };
 
 } // namespace fluent
@@ -431,16 +1361,144 @@ template <typename T, typename Parameter, template <typename> class... Skills>
 struct hash<fluent::NamedType<T, Parameter, Skills...>>
 {
     using NamedType = fluent::NamedType<T, Parameter, Skills...>;
-    using checkIfHashable = typename std::enable_if<NamedType::is_hashable, void>::type;
+    using checkIfHashable = typename std::enable_if<fluent::details::IsHashable<NamedType>, void>::type;
 
-    size_t operator()(fluent::NamedType<T, Parameter, Skills...> const& x) const noexcept
+    FLUENT_ALWAYS_INLINE constexpr size_t operator()(fluent::NamedType<T, Parameter, Skills...> const& x) const noexcept
     {
-        static_assert(noexcept(std::hash<T>()(x.get())), "hash fuction should not throw");
+        using Policy = fluent::details::hash_policy_t<NamedType>;
+        static_assert(noexcept(Policy()(x.get())), "hash fuction should not throw");
 
-        return std::hash<T>()(x.get());
+        return Policy()(x.get());
     }
 };
 
 } // namespace std
 
+namespace fluent
+{
+
+namespace details
+{
+template <typename T>
+struct is_basic_string : std::false_type
+{
+};
+
+template <typename Char, typename Traits, typename Allocator>
+struct is_basic_string<std::basic_string<Char, Traits, Allocator>> : std::true_type
+{
+    using view_type = std::basic_string_view<Char, Traits>;
+};
+
+template <typename NamedType_>
+using hashed_type_t = std::remove_cv_t<std::remove_reference_t<typename NamedType_::UnderlyingType>>;
+
+// Strings are looked up through their view, without allocating, if the hash policy accepts views.
+// The keys themselves are then hashed through their view too, so that the policy does not have to hash
+// strings and views to the same value.
+template <typename NamedType_>
+concept KeysHashedThroughView = is_basic_string<hashed_type_t<NamedType_>>::value
+                             && std::is_invocable<hash_policy_t<NamedType_>,
+                                                  typename is_basic_string<hashed_type_t<NamedType_>>::view_type>::value;
+
+template <typename NamedType_, typename U>
+concept ConvertibleToView = is_basic_string<hashed_type_t<NamedType_>>::value
+                         && std::is_convertible<U const&, typename is_basic_string<hashed_type_t<NamedType_>>::view_type>::value;
+
+template <typename NamedType_, typename U>
+concept HashedThroughView = KeysHashedThroughView<NamedType_> && ConvertibleToView<NamedType_, U>;
+
+// A type that stands for the underlying value: comparable to it, and implicitly convertible to it so that
+// it can be hashed as it. This excludes for example a size_t for a std::vector, that is only explicitly
+// constructible from it.
+template <typename NamedType_, typename U>
+concept StandsForUnderlying = std::equality_comparable_with<U const&, hashed_type_t<NamedType_> const&>
+                           && std::is_convertible<U const&, hashed_type_t<NamedType_>>::value;
+
+template <typename NamedType_, typename U>
+concept HashableAs = std::is_same<U, hashed_type_t<NamedType_>>::value || HashedThroughView<NamedType_, U>
+                  || StandsForUnderlying<NamedType_, U>;
+
+template <typename NamedType_, typename U>
+concept ComparableAs = std::is_same<U, hashed_type_t<NamedType_>>::value || ConvertibleToView<NamedType_, U>
+                    || StandsForUnderlying<NamedType_, U>;
+
+template <typename NamedType_, typename U>
+constexpr size_t hashAs(U const& value)
+{
+    using T = hashed_type_t<NamedType_>;
+    using Policy = hash_policy_t<NamedType_>;
+    if constexpr (HashedThroughView<NamedType_, U>)
+    {
+        using View = typename is_basic_string<T>::view_type;
+        return Policy()(View(value));
+    }
+    else if constexpr (std::is_same<U, T>::value)
+    {
+        return Policy()(value);
+    }
+    else
+    {
+        return Policy()(static_cast<T>(value));
+    }
+}
+} // namespace details
+
+// Hash and equality functors for heterogeneous lookup in unordered containers of strong types:
+// they also accept the underlying type, the types convertible to its view such as std::string_view for a std::string,
+// and the types comparable to it and implicitly convertible to it.
+//     std::unordered_map<SerialNumber, Record, transparent_hash<SerialNumber>, transparent_equal<SerialNumber>> records;
+//     records.find(std::string_view("AA11"));
+template <typename NamedType_>
+struct transparent_hash
+{
+    using is_transparent = void;
+
+    FLUENT_ALWAYS_INLINE constexpr size_t operator()(NamedType_ const& x) const noexcept
+    {
+        if constexpr (details::KeysHashedThroughView<NamedType_>)
+        {
+            return details::hashAs<NamedType_>(x.get());
+        }
+        else
+        {
+            return std::hash<NamedType_>()(x);
+        }
+    }
+
+    template <typename U>
+        requires(!std::is_same<U, NamedType_>::value && details::HashableAs<NamedType_, U>)
+    FLUENT_ALWAYS_INLINE constexpr size_t operator()(U const& value) const
+    {
+        return details::hashAs<NamedType_>(value);
+    }
+};
+
+template <typename NamedType_>
+struct transparent_equal
+{
+    using is_transparent = void;
+
+    FLUENT_ALWAYS_INLINE constexpr bool operator()(NamedType_ const& x, NamedType_ const& y) const
+    {
+        return x.get() == y.get();
+    }
+
+    template <typename U>
+        requires(!std::is_same<U, NamedType_>::value && details::ComparableAs<NamedType_, U>)
+    FLUENT_ALWAYS_INLINE constexpr bool operator()(NamedType_ const& x, U const& value) const
+    {
+        return x.get() == value;
+    }
+
+    template <typename U>
+        requires(!std::is_same<U, NamedType_>::value && details::ComparableAs<NamedType_, U>)
+    FLUENT_ALWAYS_INLINE constexpr bool operator()(U const& value, NamedType_ const& x) const
+    {
+        return value == x.get();
+    }
+};
+
+} // namespace fluent
+
 #endif
@@ -0,0 +1,183 @@
+#ifndef NAMED_TYPE_UNITS_HPP
+#define NAMED_TYPE_UNITS_HPP
+
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+// Strong types for physical quantities, whose products and quotients are strong types too:
+//
+//     using Meter = quantity<double, dimensions::length>;
+//     using Kilometer = quantity<double, dimensions::length, std::kilo>;
+//     using Second = quantity<double, dimensions::time>;
+//
+//     auto area = Meter(3.) * Meter(4.);                  // quantity<double, dimensions::area>
+//     auto speed = Kilometer(1.) / Second(2.);            // quantity<double, dimensions::velocity, std::kilo>
+//     auto meters = quantity_cast<Meter>(Kilometer(1.));  // Meter(1000.)
+//
+// The dimension and the scale of the result are computed at compile time, so multiplying or dividing
+// quantities only multiplies or divides their underlying values. The scale ratio is only applied by
+// quantity_cast, as a compile-time constant.
+
+namespace fluent
+{
+
+// Exponents of the SI base dimensions.
+template <int Length = 0, int Mass = 0, int Time = 0, int Current = 0, int Temperature = 0, int Amount = 0, int Luminosity = 0>
+struct dimension
+{
+};
+
+namespace dimensions
+{
+using dimensionless = dimension<>;
+using length = dimension<1>;
+using mass = dimension<0, 1>;
+using time = dimension<0, 0, 1>;
+using current = dimension<0, 0, 0, 1>;
+using temperature = dimension<0, 0, 0, 0, 1>;
+using amount = dimension<0, 0, 0, 0, 0, 1>;
+using luminosity = dimension<0, 0, 0, 0, 0, 0, 1>;
+using area = dimension<2>;
+using volume = dimension<3>;
+using velocity = dimension<1, 0, -1>;
+using acceleration = dimension<1, 0, -2>;
+using force = dimension<1, 1, -2>;
+using energy = dimension<2, 1, -2>;
+using power = dimension<2, 1, -3>;
+using frequency = dimension<0, 0, -1>;
+} // namespace dimensions
+
+namespace details
+{
+template <typename Left, typename Right, int RightSign>
+struct combine_dimensions;
+
+template <int... LeftExponents, int... RightExponents, int RightSign>
+struct combine_dimensions<dimension<LeftExponents...>, dimension<RightExponents...>, RightSign>
+{
+    using type = dimension<(LeftExponents + RightSign * RightExponents)...>;
+};
+} // namespace details
+
+template <typename Left, typename Right>
+using dimension_multiply = typename details::combine_dimensions<Left, Right, 1>::type;
+
+template <typename Left, typename Right>
+using dimension_divide = typename details::combine_dimensions<Left, Right, -1>::type;
+
+// The tag of a quantity: a value v of a quantity with Ratio represents v * Ratio base units of Dimension.
+template <typename Dimension, typename Ratio>
+struct unit
+{
+    using dimension = Dimension;
+    using ratio = Ratio;
+};
+
+template <typename T, typename Dimension, typename Ratio = std::ratio<1>>
+using quantity = NamedType<T, unit<Dimension, typename Ratio::type>, Addable, Subtractable, Comparable>;
+
+namespace details
+{
+template <typename T>
+struct quantity_traits
+{
+};
+
+template <typename T, typename Dimension, typename Ratio>
+struct quantity_traits<NamedType<T, unit<Dimension, Ratio>, Addable, Subtractable, Comparable>>
+{
+    using dimension = Dimension;
+    using ratio = Ratio;
+};
+
+template <typename T>
+concept IsQuantity = requires { typename quantity_traits<T>::dimension; };
+
+template <typename Left, typename Right>
+using quantity_product = quantity<decltype(std::declval<Left const&>().get() * std::declval<Right const&>().get()),
+                                  dimension_multiply<typename quantity_traits<Left>::dimension, typename quantity_traits<Right>::dimension>,
+                                  std::ratio_multiply<typename quantity_traits<Left>::ratio, typename quantity_traits<Right>::ratio>>;
+
+template <typename Left, typename Right>
+using quantity_quotient = quantity<decltype(std::declval<Left const&>().get() / std::declval<Right const&>().get()),
+                                   dimension_divide<typename quantity_traits<Left>::dimension, typename quantity_traits<Right>::dimension>,
+                                   std::ratio_divide<typename quantity_traits<Left>::ratio, typename quantity_traits<Right>::ratio>>;
+} // namespace details
+
+template <typename Left, typename Right>
+    requires details::IsQuantity<Left> && details::IsQuantity<Right>
+FLUENT_NODISCARD constexpr details::quantity_product<Left, Right> operator*(Left const& left, Right const& right)
+{
+    return details::quantity_product<Left, Right>(left.get() * right.get());
+}
+
+template <typename Left, typename Right>
+    requires details::IsQuantity<Left> && details::IsQuantity<Right>
+FLUENT_NODISCARD constexpr details::quantity_quotient<Left, Right> operator/(Left const& left, Right const& right)
+{
+    return details::quantity_quotient<Left, Right>(left.get() / right.get());
+}
+
+// Scaling by a number keeps the quantity.
+template <typename Quantity>
+    requires details::IsQuantity<Quantity>
+FLUENT_NODISCARD constexpr Quantity operator*(Quantity const& quantity_, typename Quantity::UnderlyingType const& factor)
+{
+    return Quantity(quantity_.get() * factor);
+}
+
+template <typename Quantity>
+    requires details::IsQuantity<Quantity>
+FLUENT_NODISCARD constexpr Quantity operator*(typename Quantity::UnderlyingType const& factor, Quantity const& quantity_)
+{
+    return Quantity(factor * quantity_.get());
+}
+
+template <typename Quantity>
+    requires details::IsQuantity<Quantity>
+FLUENT_NODISCARD constexpr Quantity operator/(Quantity const& quantity_, typename Quantity::UnderlyingType const& divisor)
+{
+    return Quantity(quantity_.get() / divisor);
+}
+
+// Converts between quantities of the same dimension and different scales. The conversion factor is a
+// compile-time constant, and is not applied at all between quantities of the same scale.
+template <typename To, typename From>
+    requires details::IsQuantity<To> && details::IsQuantity<From>
+FLUENT_NODISCARD constexpr To quantity_cast(From const& from)
+{
+    static_assert(std::is_same<typename details::quantity_traits<To>::dimension, typename details::quantity_traits<From>::dimension>::value,
+                  "quantity_cast cannot change the dimension of a quantity");
+    using Underlying = typename To::UnderlyingType;
+    using Factor = std::ratio_divide<typename details::quantity_traits<From>::ratio, typename details::quantity_traits<To>::ratio>;
+    auto const value = static_cast<Underlying>(from.get());
+    if constexpr (Factor::num == 1 && Factor::den == 1)
+    {
+        return To(value);
+    }
+    else if constexpr (Factor::den == 1)
+    {
+        return To(value * static_cast<Underlying>(Factor::num));
+    }
+    else if constexpr (Factor::num == 1)
+    {
+        return To(value / static_cast<Underlying>(Factor::den));
+    }
+    else if constexpr (std::is_floating_point<Underlying>::value)
+    {
+        constexpr auto factor = static_cast<Underlying>(Factor::num) / static_cast<Underlying>(Factor::den);
+        return To(value * factor);
+    }
+    else
+    {
+        return To(value * static_cast<Underlying>(Factor::num) / static_cast<Underlying>(Factor::den));
+    }
+}
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,118 @@
+// Built with FLUENT_INSTRUMENT defined to 1, see CMakeLists.txt.
+#include "catch.hpp"
+
+#include "NamedType/named_type.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+
+static_assert(FLUENT_INSTRUMENT == 1, "the instrumentation tests must be built with FLUENT_INSTRUMENT=1");
+
+namespace
+{
+fluent::instrumentation_counters countersOf(std::string_view tagName)
+{
+    auto const snapshot = fluent::instrumentation_snapshot();
+    auto const counters = std::find_if(snapshot.begin(), snapshot.end(), [tagName](fluent::instrumentation_counters const& entry) {
+        return entry.type_name.find(tagName) != std::string_view::npos;
+    });
+    return counters == snapshot.end() ? fluent::instrumentation_counters{} : *counters;
+}
+
+std::uint64_t countOf(std::string_view tagName, fluent::instrumented_event event)
+{
+    return countersOf(tagName).count(event);
+}
+} // namespace
+
+using Price = fluent::NamedType<int, struct InstrumentedPriceTag, fluent::Addable, fluent::Instrumented>;
+using Quantity = fluent::NamedType<int, struct NotInstrumentedQuantityTag, fluent::Addable>;
+
+TEST_CASE("Instrumented constructions")
+{
+    auto const copiesBefore = countOf("InstrumentedPriceTag", fluent::instrumented_event::copy_from_underlying);
+    auto const movesBefore = countOf("InstrumentedPriceTag", fluent::instrumented_event::move_from_underlying);
+
+    int const value = 1;
+    auto const copied = Price(value);
+    REQUIRE(countOf("InstrumentedPriceTag", fluent::instrumented_event::copy_from_underlying) == copiesBefore + 1);
+    REQUIRE(countOf("InstrumentedPriceTag", fluent::instrumented_event::move_from_underlying) == movesBefore);
+
+    auto const moved = Price(2);
+    REQUIRE(countOf("InstrumentedPriceTag", fluent::instrumented_event::copy_from_underlying) == copiesBefore + 1);
+    REQUIRE(countOf("InstrumentedPriceTag", fluent::instrumented_event::move_from_underlying) == movesBefore + 1);
+    REQUIRE(copied.get() + moved.get() == 3);
+}
+
+TEST_CASE("Instrumented operations and ref conversions")
+{
+    auto const operationsBefore = countOf("InstrumentedPriceTag", fluent::instrumented_event::binary_operation);
+    auto const refsBefore = countOf("InstrumentedPriceTag", fluent::instrumented_event::ref_conversion);
+
+    auto total = Price(1);
+    auto const sum = total + Price(2);
+    total += sum;
+    REQUIRE(total.get() == 4);
+    REQUIRE(countOf("InstrumentedPriceTag", fluent::instrumented_event::binary_operation) == operationsBefore + 2);
+
+    Price::ref reference = total;
+    reference.get() = 5;
+    REQUIRE(total.get() == 5);
+    REQUIRE(countOf("InstrumentedPriceTag", fluent::instrumented_event::ref_conversion) == refsBefore + 1);
+}
+
+TEST_CASE("Instrumentation snapshot sums the threads")
+{
+    auto const operationsBefore = countOf("InstrumentedPriceTag", fluent::instrumented_event::binary_operation);
+
+    auto worker = std::thread([]() noexcept {
+        auto total = Price(0);
+        for (int i = 0; i < 100; ++i)
+        {
+            total += Price(1);
+        }
+    });
+    worker.join();
+    REQUIRE(countOf("InstrumentedPriceTag", fluent::instrumented_event::binary_operation) == operationsBefore + 100);
+
+    auto const quantity = Quantity(1) + Quantity(2);
+    REQUIRE(quantity.get() == 3);
+    auto const snapshot = fluent::instrumentation_snapshot();
+    REQUIRE(std::none_of(snapshot.begin(), snapshot.end(), [](fluent::instrumentation_counters const& entry) {
+        return entry.type_name.find("NotInstrumentedQuantityTag") != std::string_view::npos;
+    }));
+}
+
+using Bitmask = fluent::NamedType<unsigned, struct InstrumentedBitmaskTag, fluent::BitWiseAndable, fluent::BitWiseOrable, fluent::BitWiseXorable,
+                                   fluent::ShiftableBy<unsigned>::templ, fluent::Instrumented>;
+using Amount = fluent::NamedType<int, struct InstrumentedAmountTag, fluent::ScalableBy<int>::templ, fluent::OffsetBy<int>::templ, fluent::Instrumented>;
+
+TEST_CASE("Instrumented bitwise operations and operations with another type")
+{
+    auto const bitmaskOperationsBefore = countOf("InstrumentedBitmaskTag", fluent::instrumented_event::binary_operation);
+    auto mask = (Bitmask(1u) | Bitmask(2u)) & Bitmask(3u);
+    mask ^= Bitmask(1u);
+    mask = mask << 1u;
+    mask >>= 1u;
+    REQUIRE(mask.get() == 2u);
+    REQUIRE(countOf("InstrumentedBitmaskTag", fluent::instrumented_event::binary_operation) == bitmaskOperationsBefore + 5);
+
+    auto const amountOperationsBefore = countOf("InstrumentedAmountTag", fluent::instrumented_event::binary_operation);
+    auto amount = Amount(2) * 3;
+    amount += 1;
+    REQUIRE(amount.get() == 7);
+    REQUIRE(countOf("InstrumentedAmountTag", fluent::instrumented_event::binary_operation) == amountOperationsBefore + 2);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+TEST_CASE("Instrumentation snapshot names the types readably")
+{
+    auto const price = Price(1);
+    REQUIRE(price.get() == 1);
+    auto const typeName = countersOf("InstrumentedPriceTag").type_name;
+    REQUIRE(typeName.find("fluent::NamedType<int,") != std::string_view::npos);
+    REQUIRE(typeName.find("fluent::Instrumented") != std::string_view::npos);
+}
+#endif
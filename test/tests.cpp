@@ -6,15 +6,51 @@
 
 #include "catch.hpp"
 
+#include "NamedType/atomic_named_type.hpp"
+#include "NamedType/batch.hpp"
+#include "NamedType/chrono.hpp"
+#include "NamedType/concurrent_queue.hpp"
+#include "NamedType/flags.hpp"
+#include "NamedType/flat_map.hpp"
+#include "NamedType/format.hpp"
+#include "NamedType/instrumentation.hpp"
+#include "NamedType/interned_string.hpp"
 #include "NamedType/named_type.hpp"
-
+#include "NamedType/parallel.hpp"
+#include "NamedType/serialization.hpp"
+#include "NamedType/soa_vector.hpp"
+#include "NamedType/span.hpp"
+#include "NamedType/strong_vector.hpp"
+#include "NamedType/units.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
 #include <cmath>
+#include <cstddef>
+#include <compare>
+#include <cstdint>
+#include <execution>
 #include <iomanip>
 #include <iostream>
+#include <list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <span>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <valarray>
 #include <vector>
 
 // Usage examples
@@ -140,6 +176,102 @@ TEST_CASE("Default construction")
     static_assert(!std::is_nothrow_constructible<StrongPotentiallyThrowing>::value, "StrongPotentiallyThrowing is nothrow constructible");
 }
 
+struct testRelocation_Handle
+{
+    explicit testRelocation_Handle(int value_) : value(new int(value_))
+    {
+    }
+    testRelocation_Handle(testRelocation_Handle const& other) : value(new int(*other.value))
+    {
+    }
+    testRelocation_Handle& operator=(testRelocation_Handle const&) = delete;
+    ~testRelocation_Handle()
+    {
+        delete value;
+    }
+    int* value;
+};
+
+template <>
+struct fluent::is_trivially_relocatable<testRelocation_Handle> : std::true_type
+{
+};
+
+TEST_CASE("Trivial copyability and relocatability")
+{
+    using StrongInt = fluent::NamedType<int, struct StrongIntTag, fluent::Arithmetic>;
+    static_assert(std::is_trivially_copyable<StrongInt>::value, "StrongInt is not trivially copyable");
+    static_assert(std::is_trivially_destructible<StrongInt>::value, "StrongInt is not trivially destructible");
+    static_assert(fluent::is_trivially_relocatable_v<StrongInt>, "StrongInt is not trivially relocatable");
+    static_assert(fluent::is_trivially_relocatable_v<StrongInt::ref>, "StrongInt::ref is not trivially relocatable");
+
+    using StrongString = fluent::NamedType<std::string, struct StrongStringTag, fluent::Comparable>;
+    static_assert(!std::is_trivially_copyable<StrongString>::value, "StrongString is trivially copyable");
+    static_assert(!std::is_trivially_destructible<StrongString>::value, "StrongString is trivially destructible");
+
+    using StrongHandle = fluent::NamedType<testRelocation_Handle, struct StrongHandleTag>;
+    static_assert(!std::is_trivially_copyable<StrongHandle>::value, "StrongHandle is trivially copyable");
+    static_assert(fluent::is_trivially_relocatable_v<StrongHandle>, "is_trivially_relocatable is not propagated");
+}
+
+TEST_CASE("Relocation of strong types")
+{
+    using StrongHandle = fluent::NamedType<testRelocation_Handle, struct StrongHandleTag>;
+    alignas(StrongHandle) unsigned char source[2 * sizeof(StrongHandle)];
+    alignas(StrongHandle) unsigned char destination[2 * sizeof(StrongHandle)];
+    auto* first = ::new (static_cast<void*>(source)) StrongHandle(1);
+    ::new (static_cast<void*>(source + sizeof(StrongHandle))) StrongHandle(2);
+    int* const firstValue = first->get().value;
+
+    auto* relocated = std::launder(reinterpret_cast<StrongHandle*>(destination));
+    auto* end = fluent::uninitialized_relocate(first, first + 2, relocated);
+    REQUIRE(end == relocated + 2);
+    REQUIRE(relocated[0].get().value == firstValue);
+    REQUIRE(*relocated[1].get().value == 2);
+    std::destroy(relocated, end);
+
+    using StrongString = fluent::NamedType<std::string, struct StrongStringTag>;
+    std::allocator<StrongString> allocator;
+    StrongString* strings = allocator.allocate(2);
+    StrongString* relocatedStrings = allocator.allocate(2);
+    std::uninitialized_fill_n(strings, 2, StrongString("a string that does not fit in the small buffer"));
+    auto* stringsEnd = fluent::uninitialized_relocate(strings, strings + 2, relocatedStrings);
+    REQUIRE(stringsEnd == relocatedStrings + 2);
+    REQUIRE(relocatedStrings[1].get() == "a string that does not fit in the small buffer");
+    std::destroy(relocatedStrings, stringsEnd);
+    allocator.deallocate(strings, 2);
+    allocator.deallocate(relocatedStrings, 2);
+}
+
+TEST_CASE("Allocator-aware construction")
+{
+    using StrongString = fluent::NamedType<std::pmr::string, struct StrongStringTag>;
+    static_assert(std::uses_allocator<StrongString, std::pmr::polymorphic_allocator<char>>::value,
+                  "StrongString does not use allocators");
+    static_assert(!std::uses_allocator<fluent::NamedType<int, struct StrongIntTag>, std::allocator<int>>::value,
+                  "a strong int does not use allocators");
+
+    std::byte buffer[1024];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    std::string_view const longText = "a text that is too long for the small string optimization";
+
+    StrongString direct(std::allocator_arg, std::pmr::polymorphic_allocator<char>(&arena), longText);
+    REQUIRE(direct.get() == longText);
+    REQUIRE(direct.get().get_allocator().resource() == &arena);
+
+    std::pmr::vector<StrongString> strings(&arena);
+    strings.reserve(3);
+    strings.emplace_back(longText);
+    strings.push_back(direct);
+    strings.push_back(StrongString(std::pmr::string(longText)));
+    REQUIRE(strings.size() == 3);
+    for (auto const& string : strings)
+    {
+        REQUIRE(string.get() == longText);
+        REQUIRE(string.get().get_allocator().resource() == &arena);
+    }
+}
+
 template<typename Function>
 using Comparator = fluent::NamedType<Function, struct ComparatorParameter>;
 
@@ -197,6 +329,79 @@ TEST_CASE("BinaryAddable constexpr C++17")
 }
 #endif
 
+struct testRvalueOperand_A
+{
+    explicit testRvalueOperand_A(int x_) : x(x_)
+    {
+    }
+    // ensures that chaining operations on temporaries doesn't make a copy
+    testRvalueOperand_A(testRvalueOperand_A const&) = delete;
+    testRvalueOperand_A(testRvalueOperand_A&&) = default;
+    int x;
+};
+
+// Only the overloads reusing an expiring operand are provided
+testRvalueOperand_A operator+(testRvalueOperand_A&& a1, testRvalueOperand_A const& a2)
+{
+    a1.x += a2.x;
+    return std::move(a1);
+}
+
+testRvalueOperand_A operator+(testRvalueOperand_A const& a1, testRvalueOperand_A&& a2)
+{
+    a2.x += a1.x;
+    return std::move(a2);
+}
+
+testRvalueOperand_A operator+(testRvalueOperand_A&& a1, testRvalueOperand_A&& a2)
+{
+    a1.x += a2.x;
+    return std::move(a1);
+}
+
+testRvalueOperand_A operator*(testRvalueOperand_A&& a1, testRvalueOperand_A const& a2)
+{
+    a1.x *= a2.x;
+    return std::move(a1);
+}
+
+TEST_CASE("BinaryAddable with expiring operands")
+{
+    using A = testRvalueOperand_A;
+    using StrongA = fluent::NamedType<A, struct StrongATag, fluent::BinaryAddable, fluent::Multiplicable>;
+    StrongA s1(A(1));
+    StrongA s2(A(2));
+    StrongA s3(A(3));
+
+    REQUIRE((StrongA(A(10)) + s1 + s2 + s3).get().x == 16);
+    REQUIRE((s1 + StrongA(A(10))).get().x == 11);
+    REQUIRE((StrongA(A(10)) + StrongA(A(20))).get().x == 30);
+    REQUIRE((std::move(s1) + s2).get().x == 3);
+    REQUIRE((StrongA(A(10)) * s2 * s3).get().x == 60);
+}
+
+TEST_CASE("BinaryAddable chain over std::string")
+{
+    using StrongString = fluent::NamedType<std::string, struct StrongStringTag, fluent::BinaryAddable>;
+    StrongString a("a");
+    StrongString b("b");
+    REQUIRE((a + b + StrongString("c") + a).get() == "abca");
+    REQUIRE(a.get() == "a");
+    REQUIRE(b.get() == "b");
+}
+
+TEST_CASE("Expiring strong references are not moved from")
+{
+    using StrongString = fluent::NamedType<std::string, struct StrongStringTag, fluent::BinaryAddable>;
+    std::string referred = "referred";
+    StrongString value("value");
+    StrongString::ref reference(referred);
+    static_assert(std::is_same<decltype(fluent::details::move_underlying(value)), std::string&&>::value,
+                  "the underlying value should be moved from");
+    static_assert(std::is_same<decltype(fluent::details::move_underlying(reference)), std::string&>::value,
+                  "the referred value should not be moved from");
+}
+
 TEST_CASE("UnaryAddable")
 {
     using UnaryAddableType = fluent::NamedType<int, struct UnaryAddableTag, fluent::UnaryAddable>;
@@ -349,6 +554,74 @@ TEST_CASE("Modulable constexpr C++17")
 }
 #endif
 
+struct testLazyArithmetic_Buffer
+{
+    explicit testLazyArithmetic_Buffer(std::size_t size_) : values(size_)
+    {
+        ++allocations;
+    }
+    testLazyArithmetic_Buffer(std::initializer_list<double> values_) : values(values_)
+    {
+        ++allocations;
+    }
+    std::size_t size() const
+    {
+        return values.size();
+    }
+    double& operator[](std::size_t index)
+    {
+        return values[index];
+    }
+    double const& operator[](std::size_t index) const
+    {
+        return values[index];
+    }
+    static inline int allocations = 0;
+    std::vector<double> values;
+};
+
+TEST_CASE("LazyArithmetic")
+{
+    using Samples = fluent::NamedType<std::valarray<double>, struct SamplesTag, fluent::LazyArithmetic>;
+    Samples weights(std::valarray<double>{1.0, 2.0, 3.0});
+    Samples samples(std::valarray<double>{4.0, 5.0, 6.0});
+    Samples bias(std::valarray<double>{0.5, 0.5, 0.5});
+
+    Samples result = weights * samples + bias - samples / weights;
+    REQUIRE(result.get().size() == 3);
+    CHECK(std::abs(result.get()[0] - 0.5) < 1e-9);
+    CHECK(std::abs(result.get()[1] - 8.0) < 1e-9);
+    CHECK(std::abs(result.get()[2] - 16.5) < 1e-9);
+}
+
+TEST_CASE("LazyArithmetic evaluates in a single pass")
+{
+    using Buffer = testLazyArithmetic_Buffer;
+    using Samples = fluent::NamedType<Buffer, struct SamplesTag, fluent::LazyArithmetic>;
+    Samples weights(Buffer{1.0, 2.0});
+    Samples samples(Buffer{3.0, 4.0});
+    Samples bias(Buffer{1.0, 1.0});
+
+    int const allocationsBefore = Buffer::allocations;
+    Samples result = weights * samples + bias;
+    CHECK(Buffer::allocations - allocationsBefore == 1);
+    CHECK(std::abs(result.get()[0] - 4.0) < 1e-9);
+    CHECK(std::abs(result.get()[1] - 9.0) < 1e-9);
+
+    result = fluent::evaluate(result + bias);
+    CHECK(std::abs(result.get()[1] - 10.0) < 1e-9);
+}
+
+TEST_CASE("LazyArithmetic over a scalar")
+{
+    using StrongInt = fluent::NamedType<int, struct StrongIntTag, fluent::LazyArithmetic>;
+    constexpr StrongInt a(6);
+    constexpr StrongInt b(3);
+    constexpr StrongInt c = a * b - a / b;
+    static_assert(c.get() == 16, "LazyArithmetic is not constexpr");
+    static_assert(fluent::evaluate(a + b).get() == 9, "LazyArithmetic is not constexpr");
+}
+
 TEST_CASE("BitWiseInvertable")
 {
     using BitWiseInvertableType = fluent::NamedType<int, struct BitWiseInvertableTag, fluent::BitWiseInvertable>;
@@ -540,6 +813,100 @@ TEST_CASE("Comparable constexpr")
     static_assert(!(9_meter >= 10_meter), "Comparable is not constexpr");
 }
 
+TEST_CASE("Comparable three-way")
+{
+    REQUIRE((10_meter <=> 11_meter) == std::strong_ordering::less);
+    REQUIRE((10_meter <=> 10_meter) == std::strong_ordering::equal);
+    REQUIRE((11_meter <=> 10_meter) == std::strong_ordering::greater);
+    static_assert(std::three_way_comparable<Meter>, "Comparable should provide operator<=>");
+
+    using StrongDouble = fluent::NamedType<double, struct StrongDoubleTag, fluent::Comparable>;
+    REQUIRE((StrongDouble(1.0) <=> StrongDouble(2.0)) == std::partial_ordering::less);
+
+    using StrongString = fluent::NamedType<std::string, struct StrongStringTag, fluent::Comparable>;
+    std::vector<StrongString> strings = {StrongString("b"), StrongString("c"), StrongString("a")};
+    std::ranges::sort(strings);
+    REQUIRE(std::compare_three_way()(strings[0], strings[1]) == std::strong_ordering::less);
+    REQUIRE(strings == std::vector<StrongString>{StrongString("a"), StrongString("b"), StrongString("c")});
+}
+
+TEST_CASE("Comparable three-way constexpr")
+{
+    static_assert(std::is_lt(10_meter <=> 11_meter), "Comparable is not constexpr");
+    static_assert(std::is_eq(10_meter <=> 10_meter), "Comparable is not constexpr");
+}
+
+struct testComparable_OnlyLess
+{
+    int x;
+};
+
+bool operator<(testComparable_OnlyLess const& a1, testComparable_OnlyLess const& a2)
+{
+    return a1.x < a2.x;
+}
+
+bool operator==(testComparable_OnlyLess const& a1, testComparable_OnlyLess const& a2)
+{
+    return a1.x == a2.x;
+}
+
+TEST_CASE("Comparable without three-way comparison of the underlying type")
+{
+    using A = testComparable_OnlyLess;
+    using StrongA = fluent::NamedType<A, struct StrongATag, fluent::Comparable>;
+    static_assert(!std::three_way_comparable<StrongA>, "operator<=> requires it on the underlying type");
+    REQUIRE(StrongA(A{1}) < StrongA(A{2}));
+    REQUIRE(StrongA(A{2}) >= StrongA(A{2}));
+    REQUIRE(StrongA(A{1}) != StrongA(A{2}));
+}
+
+namespace
+{
+struct OrderedByBothOperators
+{
+    int value;
+    mutable int* lessCalls;
+
+    constexpr bool operator<(OrderedByBothOperators const& other) const
+    {
+        ++*lessCalls;
+        return value < other.value;
+    }
+    constexpr std::strong_ordering operator<=>(OrderedByBothOperators const& other) const noexcept
+    {
+        return value <=> other.value;
+    }
+    constexpr bool operator==(OrderedByBothOperators const& other) const noexcept
+    {
+        return value == other.value;
+    }
+};
+} // namespace
+
+TEST_CASE("Comparable calls the relational operators of the underlying type")
+{
+    using Ordered = fluent::NamedType<OrderedByBothOperators, struct OrderedByBothOperatorsTag, fluent::Comparable>;
+    int lessCalls = 0;
+    auto const one = Ordered(OrderedByBothOperators{1, &lessCalls});
+    auto const two = Ordered(OrderedByBothOperators{2, &lessCalls});
+    REQUIRE(one < two);
+    REQUIRE(two > one);
+    REQUIRE(lessCalls == 2);
+    REQUIRE((one <=> two) == std::strong_ordering::less);
+    REQUIRE(lessCalls == 2);
+
+    using Rank = fluent::NamedType<int, struct RankTag, fluent::Comparable>;
+    static_assert(noexcept(Rank(1) < Rank(2)));
+    static_assert(noexcept(Rank(1) == Rank(2)));
+    static_assert(!noexcept(one < two));
+    static_assert(noexcept(one == two));
+
+    using OtherRank = fluent::NamedType<int, struct OtherRankTag, fluent::Comparable>;
+    static_assert(!std::is_invocable<std::compare_three_way, Rank, OtherRank>::value);
+    static_assert(!std::is_invocable<std::less<>, Rank, OtherRank>::value);
+}
+
 TEST_CASE("ConvertibleWithOperator")
 {
     struct B
@@ -672,6 +1039,147 @@ TEST_CASE("Hash")
     REQUIRE(hashMap[cc33] == 30);
 }
 
+TEST_CASE("Heterogeneous lookup with transparent hash")
+{
+    using SerialNumber = fluent::NamedType<std::string, struct SerialNumberTag, fluent::Comparable, fluent::Hashable>;
+    using Hash = fluent::transparent_hash<SerialNumber>;
+    using Equal = fluent::transparent_equal<SerialNumber>;
+
+    std::unordered_map<SerialNumber, int, Hash, Equal> hashMap = {{SerialNumber{"AA11"}, 10}, {SerialNumber{"BB22"}, 20}};
+    REQUIRE(hashMap.find(std::string_view("AA11"))->second == 10);
+    REQUIRE(hashMap.find(std::string("BB22"))->second == 20);
+    REQUIRE(hashMap.find("BB22")->second == 20);
+    REQUIRE(hashMap.find(SerialNumber{"AA11"})->second == 10);
+    REQUIRE(hashMap.find(std::string_view("CC33")) == hashMap.end());
+
+    REQUIRE(Hash()(std::string_view("AA11")) == Hash()(SerialNumber{"AA11"}));
+    REQUIRE(Equal()(std::string_view("AA11"), SerialNumber{"AA11"}));
+    REQUIRE(!Equal()(SerialNumber{"AA11"}, std::string_view("BB22")));
+}
+
+TEST_CASE("Heterogeneous lookup with transparent hash over an integer")
+{
+    using UserId = fluent::NamedType<uint64_t, struct UserIdTag, fluent::Comparable, fluent::Hashable>;
+    using Hash = fluent::transparent_hash<UserId>;
+
+    std::unordered_map<UserId, int, Hash, fluent::transparent_equal<UserId>> hashMap = {{UserId{42u}, 1}};
+    REQUIRE(hashMap.find(uint64_t{42}) != hashMap.end());
+    REQUIRE(Hash()(uint64_t{42}) == Hash()(UserId{42u}));
+}
+
+template <typename Hash, typename U>
+concept TransparentlyHashable = requires(Hash const& hash, U const& value) { hash(value); };
+
+template <typename Equal, typename NamedType_, typename U>
+concept TransparentlyEqual = requires(Equal const& equal, NamedType_ const& x, U const& value) {
+    equal(x, value);
+    equal(value, x);
+};
+
+TEST_CASE("Heterogeneous lookup only accepts types standing for the underlying value")
+{
+    using Samples = fluent::NamedType<std::vector<int>, struct SamplesTag, fluent::Comparable, fluent::Hashable>;
+    static_assert(TransparentlyHashable<fluent::transparent_hash<Samples>, std::vector<int>>);
+    static_assert(!TransparentlyHashable<fluent::transparent_hash<Samples>, size_t>);
+    static_assert(TransparentlyEqual<fluent::transparent_equal<Samples>, Samples, std::vector<int>>);
+    static_assert(!TransparentlyEqual<fluent::transparent_equal<Samples>, Samples, size_t>);
+
+    using SerialNumber = fluent::NamedType<std::string, struct SerialNumberTag, fluent::Comparable, fluent::Hashable>;
+    static_assert(TransparentlyHashable<fluent::transparent_hash<SerialNumber>, std::string_view>);
+    static_assert(TransparentlyHashable<fluent::transparent_hash<SerialNumber>, char const*>);
+    static_assert(!TransparentlyHashable<fluent::transparent_hash<SerialNumber>, char>);
+    static_assert(TransparentlyEqual<fluent::transparent_equal<SerialNumber>, SerialNumber, std::string_view>);
+    static_assert(!TransparentlyEqual<fluent::transparent_equal<SerialNumber>, SerialNumber, size_t>);
+}
+
+struct testHashPolicy_Constant
+{
+    size_t operator()(int) const noexcept
+    {
+        return 42;
+    }
+};
+
+TEST_CASE("HashableWith")
+{
+    using UserId = fluent::NamedType<uint64_t, struct UserIdTag, fluent::Comparable, fluent::HashableWith<fluent::MixedHash>::templ>;
+    REQUIRE(std::hash<UserId>()(UserId{1u}) != std::hash<UserId>()(UserId{2u}));
+    REQUIRE(std::hash<UserId>()(UserId{1u}) == fluent::MixedHash()(uint64_t{1}));
+    REQUIRE(std::hash<UserId>()(UserId{1u}) != std::hash<uint64_t>()(1u));
+
+    std::unordered_map<UserId, int> hashMap = {{UserId{1u}, 10}, {UserId{2u}, 20}};
+    REQUIRE(hashMap[UserId{2u}] == 20);
+
+    using ConstantHashed = fluent::NamedType<int, struct ConstantHashedTag, fluent::HashableWith<testHashPolicy_Constant>::templ>;
+    REQUIRE(std::hash<ConstantHashed>()(ConstantHashed{3}) == 42);
+}
+
+struct testAbslHash_State
+{
+    template <typename T>
+    static testAbslHash_State combine(testAbslHash_State state, T const& value)
+    {
+        state.combined = std::hash<T>()(value);
+        return state;
+    }
+    size_t combined;
+};
+
+TEST_CASE("HashableWith combined with Arithmetic")
+{
+    using UserId = fluent::NamedType<uint64_t, struct ArithmeticUserIdTag, fluent::Arithmetic, fluent::HashableWith<fluent::MixedHash>::templ>;
+    REQUIRE(std::hash<UserId>()(UserId{1u}) == fluent::MixedHash()(uint64_t{1}));
+    REQUIRE(AbslHashValue(testAbslHash_State{0}, UserId{7u}).combined == std::hash<uint64_t>()(7u));
+
+    std::unordered_map<UserId, int> hashMap = {{UserId{1u}, 10}, {UserId{2u}, 20}};
+    REQUIRE(hashMap[UserId{1u} + UserId{1u}] == 20);
+}
+
+TEST_CASE("HashableWith and heterogeneous lookup")
+{
+    using Symbol = fluent::NamedType<std::string, struct SymbolTag, fluent::Comparable, fluent::HashableWith<fluent::MixedHash>::templ>;
+    using Hash = fluent::transparent_hash<Symbol>;
+    REQUIRE(Hash()(std::string_view("EURUSD")) == std::hash<Symbol>()(Symbol{"EURUSD"}));
+
+    std::unordered_map<Symbol, int, Hash, fluent::transparent_equal<Symbol>> hashMap = {{Symbol{"EURUSD"}, 1}};
+    REQUIRE(hashMap.find(std::string_view("EURUSD"))->second == 1);
+    REQUIRE(Hash()(Symbol{"EURUSD"}) == Hash()(std::string_view("EURUSD")));
+    REQUIRE(Hash()(Symbol{"EURUSD"}) == Hash()(std::string("EURUSD")));
+}
+
+struct testHashPolicy_ByType
+{
+    size_t operator()(std::string const&) const noexcept
+    {
+        return 1;
+    }
+    size_t operator()(std::string_view) const noexcept
+    {
+        return 2;
+    }
+};
+
+TEST_CASE("Transparent hash of keys with a policy hashing strings and views differently")
+{
+    using Symbol = fluent::NamedType<std::string, struct ByTypeSymbolTag, fluent::Comparable, fluent::HashableWith<testHashPolicy_ByType>::templ>;
+    using Hash = fluent::transparent_hash<Symbol>;
+    REQUIRE(Hash()(Symbol{"EURUSD"}) == Hash()(std::string_view("EURUSD")));
+    REQUIRE(Hash()(Symbol{"EURUSD"}) == Hash()(std::string("EURUSD")));
+    REQUIRE(Hash()("EURUSD") == 2);
+
+    std::unordered_map<Symbol, int, Hash, fluent::transparent_equal<Symbol>> hashMap = {{Symbol{"EURUSD"}, 1}};
+    REQUIRE(hashMap.find(std::string_view("EURUSD"))->second == 1);
+}
+
+TEST_CASE("absl hash hook")
+{
+    using SerialNumber = fluent::NamedType<std::string, struct SerialNumberTag, fluent::Comparable, fluent::Hashable>;
+    using UserId = fluent::NamedType<uint64_t, struct UserIdTag, fluent::HashableWith<fluent::MixedHash>::templ>;
+
+    REQUIRE(AbslHashValue(testAbslHash_State{0}, SerialNumber{"AA11"}).combined == std::hash<std::string>()("AA11"));
+    REQUIRE(AbslHashValue(testAbslHash_State{0}, UserId{7u}).combined == std::hash<uint64_t>()(7u));
+}
+
 struct testFunctionCallable_A
 {
     testFunctionCallable_A(int x_) : x(x_)
@@ -885,6 +1393,54 @@ TEST_CASE("Named arguments in any order")
     REQUIRE(otherFullName == "JamesBond");
 }
 
+namespace
+{
+struct CopyCounter
+{
+    CopyCounter() = default;
+    CopyCounter(CopyCounter const&) noexcept
+    {
+        ++copies;
+    }
+    CopyCounter(CopyCounter&&) noexcept
+    {
+        ++moves;
+    }
+    CopyCounter& operator=(CopyCounter const&) = default;
+    CopyCounter& operator=(CopyCounter&&) = default;
+    ~CopyCounter() = default;
+
+    static int copies;
+    static int moves;
+};
+int CopyCounter::copies = 0;
+int CopyCounter::moves = 0;
+} // namespace
+
+TEST_CASE("Named arguments are forwarded without copies")
+{
+    using Source = fluent::NamedType<CopyCounter, struct SourceTag>;
+    using Destination = fluent::NamedType<CopyCounter, struct DestinationTag>;
+    using Count = fluent::NamedType<int, struct CountTag>;
+    static const Source::argument source;
+    static const Destination::argument destination;
+    static const Count::argument count;
+
+    auto transfer = fluent::named_args<Source, Destination, Count>(
+        [](Source const&, Destination const&, Count const& count_) { return count_.get(); });
+
+    CopyCounter::copies = 0;
+    CopyCounter::moves = 0;
+    Source const existingSource{CopyCounter{}};
+    Destination const existingDestination{CopyCounter{}};
+    REQUIRE(CopyCounter::moves == 2);
+
+    REQUIRE(transfer(count = 3, existingDestination, existingSource) == 3);
+    REQUIRE(transfer(destination = CopyCounter{}, count = 4, source = CopyCounter{}) == 4);
+    REQUIRE(CopyCounter::copies == 0);
+    REQUIRE(CopyCounter::moves == 4);
+}
+
 TEST_CASE("Named arguments with bracket constructor")
 {
     using Numbers = fluent::NamedType<std::vector<int>, struct NumbersTag>;
@@ -912,6 +1468,79 @@ TEST_CASE("constexpr")
     static_assert(strong_bool{true}.get(), "NamedType is not constexpr");
 }
 
+namespace
+{
+using Crc = fluent::NamedType<uint32_t, struct CrcTag, fluent::BitWiseXorable, fluent::BitWiseAndable, fluent::BitWiseRightShiftable,
+                              fluent::Comparable>;
+
+constexpr std::array<Crc, 256> makeCrcTable()
+{
+    std::array<Crc, 256> table{};
+    for (uint32_t byte = 0; byte < 256; ++byte)
+    {
+        auto crc = Crc(byte);
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            auto const lowBit = crc & Crc(1u);
+            crc >>= Crc(1u);
+            if (lowBit == Crc(1u))
+            {
+                crc ^= Crc(0xEDB88320u);
+            }
+        }
+        table[byte] = crc;
+    }
+    return table;
+}
+
+using Tick = fluent::NamedType<int64_t, struct TickTag, fluent::Arithmetic>;
+
+constexpr std::array<Tick, 1000> makePriceLadder(Tick first, Tick step)
+{
+    std::array<Tick, 1000> ladder{};
+    auto price = first;
+    for (auto& rung : ladder)
+    {
+        rung = price;
+        price += step;
+    }
+    return ladder;
+}
+
+constexpr void addTick(Tick::ref tick)
+{
+    ++tick.get();
+}
+
+constexpr Tick incremented(Tick tick)
+{
+    addTick(tick);
+    tick++;
+    --tick;
+    tick--;
+    return tick * Tick(2) / Tick(2) % Tick(1000) - Tick(0) + Tick(0);
+}
+} // namespace
+
+TEST_CASE("constexpr lookup tables")
+{
+    constexpr auto crcTable = makeCrcTable();
+    static_assert(crcTable[1] == Crc(0x77073096u), "wrong CRC table");
+    static_assert(crcTable[255] == Crc(0x2D02EF8Du), "wrong CRC table");
+
+    constexpr auto ladder = makePriceLadder(Tick(10000), Tick(5));
+    static_assert(ladder[0] == Tick(10000), "wrong price ladder");
+    static_assert(ladder[999] == Tick(10000 + 999 * 5), "wrong price ladder");
+
+    static_assert(incremented(Tick(41)) == Tick(41), "the skills or the ref conversion are not constexpr");
+
+    static constexpr Tick::argument tick;
+    constexpr Tick fromArgument = tick = 7;
+    static_assert(fromArgument == Tick(7), "argument is not constexpr");
+
+    REQUIRE(crcTable[128] == Crc(0xEDB88320u));
+}
+
 struct throw_on_construction
 {
     throw_on_construction()
@@ -972,6 +1601,21 @@ TEST_CASE("Arithmetic")
     CHECK(b.get() == 6);
 }
 
+TEST_CASE("Arithmetic has the elementary skills but not the intermediate bundles")
+{
+    using StrongInt = fluent::NamedType<int, struct ArithmeticSkillsTag, fluent::Arithmetic>;
+    static_assert(fluent::HasSkill<StrongInt, fluent::BinaryAddable>);
+    static_assert(fluent::HasSkill<StrongInt, fluent::UnarySubtractable>);
+    static_assert(fluent::HasSkill<StrongInt, fluent::PreIncrementable>);
+    static_assert(fluent::HasSkill<StrongInt, fluent::PostDecrementable>);
+    static_assert(fluent::HasSkill<StrongInt, fluent::Comparable>);
+    static_assert(fluent::HasSkill<StrongInt, fluent::Hashable>);
+    static_assert(!fluent::HasSkill<StrongInt, fluent::Addable>);
+    static_assert(!fluent::HasSkill<StrongInt, fluent::Subtractable>);
+    static_assert(!fluent::HasSkill<StrongInt, fluent::Incrementable>);
+    static_assert(!fluent::HasSkill<StrongInt, fluent::Decrementable>);
+}
+
 TEST_CASE("Version macros are defined")
 {
     static_assert(NAMED_TYPE_VERSION_MAJOR >= 1, "");
@@ -1164,6 +1808,7 @@ TEST_CASE("Empty base class optimisation of skills")
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::ImplicitlyConvertibleTo>));
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::Printable>));
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::Hashable>));
+    CHECK(sizeof(int) == sizeof(SkilledType<fluent::HashableWith<fluent::MixedHash>::templ>));
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::FunctionCallable>));
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::MethodCallable>));
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::Callable>));
@@ -1173,3 +1818,1146 @@ TEST_CASE("Empty base class optimisation of skills")
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::PreIncrementable>));
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::PreIncrementable>));
 }
+
+TEST_CASE("Batch arithmetic")
+{
+    using Distance = fluent::NamedType<double, struct DistanceTag, fluent::Addable, fluent::Subtractable, fluent::Multiplicable>;
+    std::vector<Distance> left = {Distance(1.0), Distance(2.0), Distance(3.0)};
+    std::vector<Distance> right = {Distance(4.0), Distance(5.0), Distance(6.0)};
+    std::vector<Distance> result(3);
+
+    fluent::batch::add(left, right, result);
+    CHECK(std::abs(result[1].get() - 7.0) < 1e-9);
+
+    fluent::batch::subtract(left, right, result);
+    CHECK(std::abs(result[1].get() + 3.0) < 1e-9);
+
+    fluent::batch::multiply(left, right, std::span<Distance>(result));
+    CHECK(std::abs(result[2].get() - 18.0) < 1e-9);
+
+    fluent::batch::add(result, right, result);
+    CHECK(std::abs(result[2].get() - 24.0) < 1e-9);
+
+    CHECK(std::abs(fluent::batch::sum(left).get() - 6.0) < 1e-9);
+    CHECK(std::abs(fluent::batch::product(std::span<Distance const>(right)).get() - 120.0) < 1e-9);
+}
+
+TEST_CASE("Batch comparison")
+{
+    using Count = fluent::NamedType<uint32_t, struct CountTag, fluent::Comparable>;
+    std::array<Count, 4> left = {Count(1u), Count(5u), Count(3u), Count(8u)};
+    std::array<Count, 4> right = {Count(2u), Count(4u), Count(3u), Count(9u)};
+    std::array<Count, 4> result{};
+
+    fluent::batch::min(left, right, result);
+    CHECK(result[0].get() == 1u);
+    CHECK(result[1].get() == 4u);
+
+    fluent::batch::max(left, right, result);
+    CHECK(result[0].get() == 2u);
+    CHECK(result[1].get() == 5u);
+
+    std::array<bool, 4> mask{};
+    fluent::batch::less(left, right, mask);
+    CHECK(mask == std::array<bool, 4>{true, false, false, true});
+
+    fluent::batch::equal(left, right, mask);
+    CHECK(mask == std::array<bool, 4>{false, false, true, false});
+}
+
+template <typename Range>
+concept Summable = requires(Range const& range) { fluent::batch::sum(range); };
+
+TEST_CASE("Batch operations require the skill")
+{
+    using Addable = fluent::NamedType<int, struct AddableTag, fluent::Addable>;
+    using NotAddable = fluent::NamedType<int, struct NotAddableTag, fluent::Comparable>;
+    static_assert(Summable<std::vector<Addable>>, "batch::sum should be available for Addable types");
+    static_assert(!Summable<std::vector<NotAddable>>, "batch::sum should require the Addable skill");
+}
+
+template <typename Left, typename Right, typename Result>
+concept BatchAddable = requires(Left const& left, Right const& right, Result& result) { fluent::batch::add(left, right, result); };
+
+template <typename Left, typename Right>
+concept BatchLessComparable = requires(Left const& left, Right const& right, std::span<bool> mask) { fluent::batch::less(left, right, mask); };
+
+TEST_CASE("Batch operations require operands of the same strong type")
+{
+    using Metre = fluent::NamedType<double, struct BatchMetreTag, fluent::Addable, fluent::Comparable>;
+    using Second = fluent::NamedType<double, struct BatchSecondTag, fluent::Addable, fluent::Comparable>;
+    static_assert(BatchAddable<std::vector<Metre>, std::vector<Metre>, std::vector<Metre>>);
+    static_assert(!BatchAddable<std::vector<Metre>, std::vector<Second>, std::vector<Metre>>);
+    static_assert(!BatchAddable<std::vector<Metre>, std::vector<Metre>, std::vector<Second>>);
+    static_assert(BatchLessComparable<std::vector<Metre>, std::vector<Metre>>);
+    static_assert(!BatchLessComparable<std::vector<Metre>, std::vector<Second>>);
+}
+
+TEST_CASE("View a range of strong types as a span of the underlying type")
+{
+    std::vector<Meter> meters = {1_meter, 2_meter, 3_meter};
+
+    std::span<unsigned long long> raw = fluent::as_underlying_span(meters);
+    REQUIRE(raw.size() == 3);
+    REQUIRE(raw.data() == &meters[0].get());
+    raw[1] = 20;
+    REQUIRE(meters[1].get() == 20);
+
+    std::span<unsigned long long const> constRaw = fluent::as_underlying_span(std::as_const(meters));
+    REQUIRE(constRaw[2] == 3);
+}
+
+TEST_CASE("View a range of underlying values as a span of strong types")
+{
+    std::vector<unsigned long long> raw = {1, 2, 3};
+
+    std::span<Meter> meters = fluent::as_named_span<Meter>(raw);
+    REQUIRE(meters.size() == 3);
+    REQUIRE((meters[0] + meters[2]) == 4_meter);
+
+    std::span<Meter const> constMeters = fluent::as_named_span<Meter>(std::span<unsigned long long const>(raw));
+    REQUIRE(constMeters[1] == 2_meter);
+}
+
+template <typename Range>
+concept ViewableAsUnderlying = requires(Range&& range) { fluent::as_underlying_span(std::forward<Range>(range)); };
+
+TEST_CASE("Layout compatibility of strong types")
+{
+    static_assert(fluent::UnderlyingLayoutCompatible<Meter>, "Meter should have the layout of its underlying type");
+    static_assert(fluent::UnderlyingLayoutCompatible<SkilledType<fluent::Arithmetic>>, "skills should not change the layout");
+    static_assert(!fluent::UnderlyingLayoutCompatible<NameRef>, "strong references have no underlying value");
+    static_assert(ViewableAsUnderlying<std::vector<Meter>&>, "lvalue ranges can be viewed");
+    static_assert(!ViewableAsUnderlying<std::vector<Meter>>, "temporary ranges would dangle");
+}
+
+TEST_CASE("soa_vector")
+{
+    using Price = fluent::NamedType<int64_t, struct PriceTag, fluent::Addable, fluent::Comparable>;
+    using Quantity = fluent::NamedType<uint32_t, struct QuantityTag, fluent::Addable, fluent::Comparable>;
+    using OrderId = fluent::NamedType<uint32_t, struct OrderIdTag, fluent::Comparable>;
+
+    fluent::soa_vector<Price, Quantity, OrderId> orders;
+    REQUIRE(orders.empty());
+    orders.reserve(3);
+    orders.push_back(Price(1050), Quantity(100u), OrderId(1u));
+    orders.push_back(Price(1100), Quantity(50u), OrderId(2u));
+    orders.push_back(Price(950), Quantity(25u), OrderId(3u));
+    REQUIRE(orders.size() == 3);
+
+    std::span<Quantity> quantities = orders.column<Quantity>();
+    REQUIRE(quantities.size() == 3);
+    REQUIRE(fluent::batch::sum(quantities) == Quantity(175u));
+    quantities[1] += Quantity(10u);
+
+    auto [price, quantity, orderId] = orders[1];
+    REQUIRE(price == Price(1100));
+    REQUIRE(quantity == Quantity(60u));
+    REQUIRE(orderId == OrderId(2u));
+
+    std::span<uint32_t const> rawIds = std::as_const(orders).underlying_column<OrderId>();
+    REQUIRE(rawIds[2] == 3u);
+
+    orders.pop_back();
+    REQUIRE(orders.size() == 2);
+    REQUIRE(std::as_const(orders).column<Price>().back() == Price(1100));
+
+    orders.clear();
+    REQUIRE(orders.empty());
+}
+
+struct testSoaVector_ThrowingCopy
+{
+    explicit testSoaVector_ThrowingCopy(bool throws_) : throws(throws_)
+    {
+    }
+    testSoaVector_ThrowingCopy(testSoaVector_ThrowingCopy const& other) : throws(other.throws)
+    {
+        if (throws)
+        {
+            throw std::runtime_error("copy");
+        }
+    }
+    testSoaVector_ThrowingCopy& operator=(testSoaVector_ThrowingCopy const&) = default;
+    bool throws;
+};
+
+TEST_CASE("soa_vector push_back is all or nothing")
+{
+    using Id = fluent::NamedType<int, struct IdTag>;
+    using Payload = fluent::NamedType<testSoaVector_ThrowingCopy, struct PayloadTag>;
+
+    fluent::soa_vector<Id, Payload> records;
+    records.push_back(Id(1), Payload(false));
+    REQUIRE_THROWS(records.push_back(Id(2), Payload(true)));
+    REQUIRE(records.size() == 1);
+    REQUIRE(records.column<Id>().size() == 1);
+}
+
+struct testSoaVector_ThrowingDefault
+{
+    testSoaVector_ThrowingDefault() : value(0)
+    {
+        if (throwsOnDefault)
+        {
+            throw std::runtime_error("default");
+        }
+    }
+    static inline bool throwsOnDefault = false;
+    int value;
+};
+
+TEST_CASE("soa_vector resize is all or nothing")
+{
+    using Id = fluent::NamedType<int, struct IdTag>;
+    using Payload = fluent::NamedType<testSoaVector_ThrowingDefault, struct DefaultedPayloadTag>;
+
+    fluent::soa_vector<Id, Payload> records;
+    records.resize(1);
+    testSoaVector_ThrowingDefault::throwsOnDefault = true;
+    REQUIRE_THROWS(records.resize(3));
+    testSoaVector_ThrowingDefault::throwsOnDefault = false;
+    REQUIRE(records.size() == 1);
+    REQUIRE(records.column<Id>().size() == 1);
+    REQUIRE(records.column<Payload>().size() == 1);
+}
+
+TEST_CASE("Quantities")
+{
+    using Metre = fluent::quantity<int64_t, fluent::dimensions::length>;
+    using Millimetre = fluent::quantity<int64_t, fluent::dimensions::length, std::milli>;
+    using Kilometre = fluent::quantity<int64_t, fluent::dimensions::length, std::kilo>;
+    using Second = fluent::quantity<int64_t, fluent::dimensions::time>;
+    using SquareMetre = fluent::quantity<int64_t, fluent::dimensions::area>;
+    using MetrePerSecond = fluent::quantity<int64_t, fluent::dimensions::velocity>;
+
+    static_assert(std::is_same<decltype(Metre(3) * Metre(4)), SquareMetre>::value, "length times length is not an area");
+    static_assert(std::is_same<decltype(Metre(3) / Second(4)), MetrePerSecond>::value, "length over time is not a velocity");
+    static_assert(std::is_same<decltype(Metre(3) / Metre(4)), fluent::quantity<int64_t, fluent::dimensions::dimensionless>>::value,
+                  "length over length is not dimensionless");
+    static_assert(std::is_same<decltype(Kilometre(3) * Millimetre(4)), SquareMetre>::value, "the scales do not fold");
+    static_assert(std::is_same<fluent::quantity<int64_t, fluent::dimensions::length, std::ratio<2000, 2>>, Kilometre>::value,
+                  "the scale ratios are not normalized");
+
+    REQUIRE(Metre(3) * Metre(4) == SquareMetre(12));
+    REQUIRE(Metre(12) / Second(4) == MetrePerSecond(3));
+    REQUIRE((Metre(3) * Metre(4)) / Metre(4) == Metre(3));
+    REQUIRE(Metre(3) + Metre(4) == Metre(7));
+    REQUIRE(Metre(3) * 2 == Metre(6));
+    REQUIRE(2 * Metre(3) == Metre(6));
+    REQUIRE(Metre(6) / 2 == Metre(3));
+
+    REQUIRE(fluent::quantity_cast<Metre>(Kilometre(2)) == Metre(2000));
+    REQUIRE(fluent::quantity_cast<Kilometre>(Metre(2000)) == Kilometre(2));
+    REQUIRE(fluent::quantity_cast<Millimetre>(Kilometre(1)) == Millimetre(1000000));
+    constexpr auto metres = fluent::quantity_cast<Metre>(Kilometre(3));
+    static_assert(metres.get() == 3000, "quantity_cast is not constexpr");
+}
+
+TEST_CASE("Saturating arithmetic")
+{
+    using PacketCount = fluent::NamedType<uint8_t, struct PacketCountTag, fluent::SaturatingAddable, fluent::SaturatingSubtractable, fluent::Comparable>;
+    using Offset = fluent::NamedType<int32_t, struct OffsetTag, fluent::SaturatingAddable, fluent::SaturatingSubtractable, fluent::Comparable>;
+
+    REQUIRE(PacketCount(uint8_t{200}) + PacketCount(uint8_t{50}) == PacketCount(uint8_t{250}));
+    REQUIRE(PacketCount(uint8_t{200}) + PacketCount(uint8_t{100}) == PacketCount(uint8_t{255}));
+    REQUIRE(PacketCount(uint8_t{10}) - PacketCount(uint8_t{20}) == PacketCount(uint8_t{0}));
+    REQUIRE(PacketCount(uint8_t{20}) - PacketCount(uint8_t{10}) == PacketCount(uint8_t{10}));
+
+    constexpr auto max = std::numeric_limits<int32_t>::max();
+    constexpr auto min = std::numeric_limits<int32_t>::min();
+    REQUIRE(Offset(max) + Offset(1) == Offset(max));
+    REQUIRE(Offset(min) + Offset(-1) == Offset(min));
+    REQUIRE(Offset(min) - Offset(1) == Offset(min));
+    REQUIRE(Offset(max) - Offset(-1) == Offset(max));
+    REQUIRE(Offset(-5) + Offset(3) == Offset(-2));
+    static_assert((Offset(max) + Offset(max)).get() == max, "saturating addition is not constexpr");
+
+    auto count = PacketCount(uint8_t{250});
+    count += PacketCount(uint8_t{10});
+    REQUIRE(count == PacketCount(uint8_t{255}));
+    count -= PacketCount(uint8_t{255});
+    count -= PacketCount(uint8_t{1});
+    REQUIRE(count == PacketCount(uint8_t{0}));
+
+    std::vector<PacketCount> const left = {PacketCount(uint8_t{1}), PacketCount(uint8_t{200}), PacketCount(uint8_t{0})};
+    std::vector<PacketCount> const right = {PacketCount(uint8_t{2}), PacketCount(uint8_t{100}), PacketCount(uint8_t{1})};
+    std::vector<PacketCount> result(3, PacketCount(uint8_t{0}));
+    fluent::batch::saturating_add(left, right, result);
+    REQUIRE(result == std::vector<PacketCount>{PacketCount(uint8_t{3}), PacketCount(uint8_t{255}), PacketCount(uint8_t{1})});
+    fluent::batch::saturating_subtract(left, right, result);
+    REQUIRE(result == std::vector<PacketCount>{PacketCount(uint8_t{0}), PacketCount(uint8_t{100}), PacketCount(uint8_t{0})});
+}
+
+TEST_CASE("Checked multiplication")
+{
+    using Bytes = fluent::NamedType<uint32_t, struct BytesTag, fluent::CheckedMultiplicable, fluent::Comparable>;
+    using Delta = fluent::NamedType<int16_t, struct DeltaTag, fluent::CheckedMultiplicable, fluent::Comparable>;
+
+    REQUIRE(Bytes(1000u) * Bytes(1000u) == Bytes(1000000u));
+    REQUIRE_THROWS_AS(Bytes(100000u) * Bytes(100000u), std::overflow_error);
+    REQUIRE(Delta(int16_t{-128}) * Delta(int16_t{256}) == Delta(int16_t{-32768}));
+    REQUIRE_THROWS_AS(Delta(int16_t{-32768}) * Delta(int16_t{-1}), std::overflow_error);
+
+    auto bytes = Bytes(2u);
+    bytes *= Bytes(3u);
+    REQUIRE(bytes == Bytes(6u));
+    REQUIRE_THROWS_AS(bytes *= Bytes(0x80000000u), std::overflow_error);
+    REQUIRE(bytes == Bytes(6u));
+
+    std::vector<Bytes> const left = {Bytes(2u), Bytes(3u)};
+    std::vector<Bytes> right = {Bytes(5u), Bytes(7u)};
+    std::vector<Bytes> result(2, Bytes(0u));
+    fluent::batch::checked_multiply(left, right, result);
+    REQUIRE(result == std::vector<Bytes>{Bytes(10u), Bytes(21u)});
+    right[1] = Bytes(0x80000000u);
+    REQUIRE_THROWS_AS(fluent::batch::checked_multiply(left, right, result), std::overflow_error);
+}
+
+template <typename Atomic>
+concept CanFetchAdd = requires(Atomic& atomic, typename Atomic::value_type const& operand) { atomic.fetch_add(operand); };
+
+TEST_CASE("Atomic strong types")
+{
+    using SequenceNumber = fluent::NamedType<uint64_t, struct SequenceNumberTag, fluent::Addable, fluent::Subtractable, fluent::Comparable>;
+    using AtomicSequenceNumber =
+        fluent::AtomicNamedType<uint64_t, struct SequenceNumberTag, fluent::Addable, fluent::Subtractable, fluent::Comparable>;
+    static_assert(std::is_same<AtomicSequenceNumber::value_type, SequenceNumber>::value, "wrong value type");
+    static_assert(AtomicSequenceNumber::is_always_lock_free, "a 64-bit atomic is not lock-free");
+
+    AtomicSequenceNumber next{SequenceNumber(uint64_t{10})};
+    REQUIRE(next.load() == SequenceNumber(uint64_t{10}));
+    REQUIRE(next.fetch_add(SequenceNumber(uint64_t{5}), std::memory_order_relaxed) == SequenceNumber(uint64_t{10}));
+    REQUIRE(next.fetch_sub(SequenceNumber(uint64_t{3})) == SequenceNumber(uint64_t{15}));
+    REQUIRE(next.load(std::memory_order_acquire) == SequenceNumber(uint64_t{12}));
+
+    next.store(SequenceNumber(uint64_t{20}), std::memory_order_release);
+    REQUIRE(next.exchange(SequenceNumber(uint64_t{30})) == SequenceNumber(uint64_t{20}));
+
+    auto expected = SequenceNumber(uint64_t{0});
+    REQUIRE_FALSE(next.compare_exchange_strong(expected, SequenceNumber(uint64_t{40})));
+    REQUIRE(expected == SequenceNumber(uint64_t{30}));
+    REQUIRE(next.compare_exchange_strong(expected, SequenceNumber(uint64_t{40}), std::memory_order_acq_rel, std::memory_order_acquire));
+    REQUIRE(next.load() == SequenceNumber(uint64_t{40}));
+
+    using AtomicId = fluent::AtomicNamedType<uint32_t, struct IdTag>;
+    AtomicId id;
+    REQUIRE(id.load().get() == 0u);
+    static_assert(!CanFetchAdd<AtomicId>, "an atomic of a non-addable type can be added to");
+    static_assert(CanFetchAdd<AtomicSequenceNumber>, "an atomic of an addable type cannot be added to");
+}
+
+TEST_CASE("Padded atomic strong types")
+{
+    using Count = fluent::NamedType<uint64_t, struct CountTag, fluent::Addable>;
+    using PaddedCount = fluent::PaddedAtomicNamedType<uint64_t, struct CountTag, fluent::Addable>;
+    static_assert(alignof(PaddedCount) == FLUENT_CACHE_LINE_SIZE, "padded atomics are not aligned on cache lines");
+    static_assert(sizeof(PaddedCount) == FLUENT_CACHE_LINE_SIZE, "padded atomics do not fill their cache line");
+
+    std::array<PaddedCount, 4> perCoreCounts{};
+    perCoreCounts[1].fetch_add(Count(uint64_t{2}), std::memory_order_relaxed);
+    perCoreCounts[3].fetch_add(Count(uint64_t{5}), std::memory_order_relaxed);
+    uint64_t total = 0;
+    for (auto const& count : perCoreCounts)
+    {
+        total += count.load(std::memory_order_relaxed).get();
+    }
+    REQUIRE(total == 7);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(&perCoreCounts[1]) - reinterpret_cast<std::uintptr_t>(&perCoreCounts[0]) == FLUENT_CACHE_LINE_SIZE);
+}
+
+TEST_CASE("Formattable")
+{
+    using OrderId = fluent::NamedType<uint64_t, struct OrderIdTag, fluent::Formattable>;
+    using Ratio = fluent::NamedType<double, struct RatioTag, fluent::Formattable>;
+
+    char buffer[32];
+    auto const result = OrderId(uint64_t{1234567}).to_chars(std::begin(buffer), std::end(buffer));
+    REQUIRE(result.ec == std::errc{});
+    REQUIRE(std::string_view(buffer, static_cast<std::size_t>(result.ptr - buffer)) == "1234567");
+
+    auto const hexResult = OrderId(uint64_t{255}).to_chars(std::begin(buffer), std::end(buffer), 16);
+    REQUIRE(std::string_view(buffer, static_cast<std::size_t>(hexResult.ptr - buffer)) == "ff");
+
+    auto const ratioResult = Ratio(0.25).to_chars(std::begin(buffer), std::end(buffer), std::chars_format::scientific);
+    REQUIRE(std::string_view(buffer, static_cast<std::size_t>(ratioResult.ptr - buffer)) == "2.5e-01");
+
+    char tooSmall[3];
+    REQUIRE(OrderId(uint64_t{1234567}).to_chars(std::begin(tooSmall), std::end(tooSmall)).ec == std::errc::value_too_large);
+}
+
+TEST_CASE("Parsable")
+{
+    using OrderId = fluent::NamedType<uint64_t, struct OrderIdTag, fluent::Formattable, fluent::Parsable>;
+
+    std::string_view const text = "1234567,89";
+    auto orderId = OrderId(uint64_t{0});
+    auto const result = orderId.from_chars(text.data(), text.data() + text.size());
+    REQUIRE(result.ec == std::errc{});
+    REQUIRE(*result.ptr == ',');
+    REQUIRE(orderId.get() == 1234567);
+
+    std::string_view const hexText = "ff";
+    orderId.from_chars(hexText.data(), hexText.data() + hexText.size(), 16);
+    REQUIRE(orderId.get() == 255);
+
+    std::string_view const notANumber = "abc";
+    REQUIRE(orderId.from_chars(notANumber.data(), notANumber.data() + notANumber.size()).ec == std::errc::invalid_argument);
+    REQUIRE(orderId.get() == 255);
+
+    char buffer[32];
+    auto const written = OrderId(uint64_t{987654321}).to_chars(std::begin(buffer), std::end(buffer));
+    auto roundTrip = OrderId(uint64_t{0});
+    roundTrip.from_chars(buffer, written.ptr);
+    REQUIRE(roundTrip.get() == 987654321);
+}
+
+#if FLUENT_FMT
+TEST_CASE("Formatting with fmt")
+{
+    using OrderId = fluent::NamedType<uint64_t, struct OrderIdTag, fluent::Formattable>;
+    REQUIRE(fmt::format("{}", OrderId(uint64_t{42})) == "42");
+    REQUIRE(fmt::format("{:>5}", OrderId(uint64_t{42})) == "   42");
+    REQUIRE(fmt::format("{:x}", OrderId(uint64_t{255})) == "ff");
+}
+#endif
+
+#if defined(__cpp_lib_format)
+TEST_CASE("Formatting with std::format")
+{
+    using OrderId = fluent::NamedType<uint64_t, struct OrderIdTag, fluent::Formattable>;
+    REQUIRE(std::format("{}", OrderId(uint64_t{42})) == "42");
+    REQUIRE(std::format("{:>5}", OrderId(uint64_t{42})) == "   42");
+}
+#endif
+
+TEST_CASE("Serialization in an explicit byte order")
+{
+    using Price = fluent::NamedType<uint32_t, struct PriceTag, fluent::Serializable, fluent::Comparable>;
+
+    std::byte buffer[8];
+    auto const rest = fluent::serialize<std::endian::big>(Price(0x01020304u), buffer);
+    REQUIRE(rest.size() == 4);
+    REQUIRE(buffer[0] == std::byte{0x01});
+    REQUIRE(buffer[3] == std::byte{0x04});
+    fluent::serialize<std::endian::little>(Price(0x01020304u), rest);
+    REQUIRE(buffer[4] == std::byte{0x04});
+    REQUIRE(buffer[7] == std::byte{0x01});
+
+    REQUIRE(fluent::deserialize<Price, std::endian::big>(buffer) == Price(0x01020304u));
+    REQUIRE(fluent::deserialize<Price, std::endian::little>(std::span<std::byte const>(buffer).subspan(4)) == Price(0x01020304u));
+
+    std::vector<Price> const prices = {Price(1u), Price(2u), Price(3u)};
+    std::byte pricesBuffer[12];
+    REQUIRE(fluent::serialize<std::endian::big>(prices, pricesBuffer).empty());
+    std::vector<Price> readPrices(3, Price(0u));
+    REQUIRE(fluent::deserialize<std::endian::big>(pricesBuffer, readPrices).empty());
+    REQUIRE(readPrices == prices);
+
+    REQUIRE_THROWS_AS(fluent::serialize<std::endian::big>(prices, std::span<std::byte>(pricesBuffer).first(8)), std::length_error);
+    REQUIRE_THROWS_AS((fluent::deserialize<Price, std::endian::big>(std::span<std::byte const>(buffer).first(2))), std::length_error);
+
+    using Unserializable = fluent::NamedType<uint32_t, struct UnserializableTag>;
+    static_assert(!fluent::SerializableNamedType<Unserializable>, "serialization must be enabled by the skill");
+}
+
+template <typename NamedType_, std::endian Order>
+concept testSerialization_Viewable = requires(std::span<std::byte const> bytes) { fluent::view_as<NamedType_, Order>(bytes); };
+
+TEST_CASE("Zero-copy view of serialized strong types")
+{
+    using Price = fluent::NamedType<int64_t, struct PriceTag, fluent::Serializable, fluent::Comparable>;
+    constexpr auto otherOrder = std::endian::native == std::endian::little ? std::endian::big : std::endian::little;
+
+    std::vector<Price> const prices = {Price(10), Price(-20), Price(30)};
+    alignas(Price) std::byte mapped[3 * sizeof(Price) + alignof(Price)];
+    fluent::serialize<std::endian::native>(prices, mapped);
+
+    auto const view = fluent::view_as<Price, std::endian::native>(std::span<std::byte const>(mapped).first(3 * sizeof(Price)));
+    REQUIRE(view.size() == 3);
+    REQUIRE(static_cast<void const*>(view.data()) == static_cast<void const*>(mapped));
+    REQUIRE(std::equal(view.begin(), view.end(), prices.begin(), prices.end()));
+
+    REQUIRE_THROWS_AS((fluent::view_as<Price, std::endian::native>(std::span<std::byte const>(mapped).subspan(1, 2 * sizeof(Price)))),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS((fluent::view_as<Price, std::endian::native>(std::span<std::byte const>(mapped).first(sizeof(Price) + 1))),
+                      std::invalid_argument);
+    static_assert(!testSerialization_Viewable<Price, otherOrder>);
+
+    using Flag = fluent::NamedType<std::uint8_t, struct FlagTag, fluent::Serializable, fluent::Comparable>;
+    static_assert(testSerialization_Viewable<Flag, otherOrder>);
+    REQUIRE(fluent::view_as<Flag, otherOrder>(std::span<std::byte const>(mapped).first(2)).size() == 2);
+}
+
+TEST_CASE("Moving out of an expiring strong type")
+{
+    using Buffer = fluent::NamedType<std::vector<int>, struct BufferTag, fluent::Dereferencable, fluent::FunctionCallable>;
+    static_assert(std::is_same<decltype(std::declval<Buffer>().get()), std::vector<int>&&>::value, "get() does not move");
+    static_assert(std::is_same<decltype(std::declval<Buffer const>().get()), std::vector<int> const&&>::value, "wrong const get()");
+    static_assert(std::is_same<decltype(*std::declval<Buffer>()), std::vector<int>&&>::value, "operator* does not move");
+
+    using BufferRef = fluent::NamedType<std::vector<int>&, struct BufferRefTag>;
+    static_assert(std::is_same<decltype(std::declval<BufferRef>().get()), std::vector<int>&>::value,
+                  "a strong reference must not move the referenced object");
+    static_assert(std::is_same<decltype(std::declval<BufferRef const>().get()), std::vector<int> const&>::value,
+                  "wrong const get() of a strong reference");
+
+    auto buffer = Buffer(std::vector<int>{1, 2, 3});
+    auto const data = buffer.get().data();
+    auto const moved = std::move(buffer).get();
+    REQUIRE(moved.data() == data);
+
+    auto otherBuffer = Buffer(std::vector<int>{4, 5});
+    auto const otherData = otherBuffer.get().data();
+    auto const dereferenced = *std::move(otherBuffer);
+    REQUIRE(dereferenced.data() == otherData);
+
+    auto lastBuffer = Buffer(std::vector<int>{6});
+    auto const lastData = lastBuffer.get().data();
+    std::vector<int> const converted = std::move(lastBuffer);
+    REQUIRE(converted.data() == lastData);
+}
+
+namespace
+{
+struct PreIncrementOnly
+{
+    int value = 0;
+    PreIncrementOnly& operator++()
+    {
+        ++value;
+        return *this;
+    }
+    PreIncrementOnly& operator--()
+    {
+        --value;
+        return *this;
+    }
+};
+} // namespace
+
+TEST_CASE("Post-increment of underlying types with a pre-increment only")
+{
+    using Counter = fluent::NamedType<PreIncrementOnly, struct CounterTag, fluent::PostIncrementable, fluent::PostDecrementable>;
+    auto counter = Counter(PreIncrementOnly{41});
+    REQUIRE((counter++).get().value == 41);
+    REQUIRE(counter.get().value == 42);
+    REQUIRE((counter--).get().value == 42);
+    REQUIRE(counter.get().value == 41);
+}
+
+template <typename Container, typename Index>
+concept CanIndex = requires(Container const& container, Index index) { container[index]; };
+
+TEST_CASE("strong_vector")
+{
+    using NodeId = fluent::NamedType<uint32_t, struct NodeIdTag, fluent::Incrementable, fluent::Comparable>;
+    using EdgeId = fluent::NamedType<uint32_t, struct EdgeIdTag>;
+
+    fluent::strong_vector<NodeId, std::string> names;
+    auto const first = names.next_index();
+    names.push_back("first");
+    auto const second = names.next_index();
+    names.emplace_back("second");
+
+    REQUIRE(first == NodeId(0u));
+    REQUIRE(second == NodeId(1u));
+    REQUIRE(names.size() == 2);
+    REQUIRE(names[first] == "first");
+    REQUIRE(names.at(second) == "second");
+    REQUIRE(names.contains(second));
+    REQUIRE_FALSE(names.contains(NodeId(2u)));
+    REQUIRE_THROWS_AS(names.at(NodeId(2u)), std::out_of_range);
+
+    names[second] = "other";
+    REQUIRE(names.underlying() == std::vector<std::string>{"first", "other"});
+
+    static_assert(CanIndex<fluent::strong_vector<NodeId, int>, NodeId>, "a strong vector cannot be indexed by its index type");
+    static_assert(!CanIndex<fluent::strong_vector<NodeId, int>, EdgeId>, "a strong vector can be indexed by another strong type");
+    static_assert(!CanIndex<fluent::strong_vector<NodeId, int>, uint32_t>, "a strong vector can be indexed by an integer");
+
+    using SignedId = fluent::NamedType<int, struct SignedIdTag>;
+    fluent::strong_vector<SignedId, int> const values = {1, 2, 3};
+    REQUIRE_FALSE(values.contains(SignedId(-1)));
+    REQUIRE(values[SignedId(2)] == 3);
+}
+
+TEST_CASE("flat_map")
+{
+    using NodeId = fluent::NamedType<uint32_t, struct NodeIdTag, fluent::Comparable>;
+
+    std::vector<std::pair<NodeId, int>> const unsorted = {{NodeId(5u), 50}, {NodeId(1u), 10}, {NodeId(3u), 30}, {NodeId(1u), 11}};
+    fluent::flat_map<NodeId, int> weights(unsorted);
+    REQUIRE(weights.size() == 3);
+    REQUIRE(std::equal(weights.keys().begin(), weights.keys().end(), std::vector<NodeId>{NodeId(1u), NodeId(3u), NodeId(5u)}.begin()));
+    REQUIRE(weights.at(NodeId(1u)) == 10);
+    REQUIRE(weights.contains(NodeId(3u)));
+    REQUIRE_FALSE(weights.contains(NodeId(4u)));
+    REQUIRE(weights.find(NodeId(4u)) == nullptr);
+    REQUIRE(*weights.find(NodeId(5u)) == 50);
+    REQUIRE_THROWS_AS(weights.at(NodeId(4u)), std::out_of_range);
+
+    REQUIRE(weights.insert_or_assign(NodeId(4u), 40));
+    REQUIRE_FALSE(weights.insert_or_assign(NodeId(4u), 41));
+    REQUIRE(weights[NodeId(4u)] == 41);
+    REQUIRE(weights[NodeId(0u)] == 0);
+    REQUIRE(weights.keys().front() == NodeId(0u));
+    REQUIRE(weights.erase(NodeId(3u)));
+    REQUIRE_FALSE(weights.erase(NodeId(3u)));
+    REQUIRE(std::vector<int>(weights.values().begin(), weights.values().end()) == std::vector<int>{0, 10, 41, 50});
+
+    fluent::flat_map<NodeId, int> const sorted(fluent::sorted_unique, {NodeId(2u), NodeId(7u)}, {20, 70});
+    REQUIRE(sorted.at(NodeId(7u)) == 70);
+    REQUIRE_THROWS_AS((fluent::flat_map<NodeId, int>(fluent::sorted_unique, {NodeId(2u)}, {})), std::invalid_argument);
+}
+
+TEST_CASE("Interned strings")
+{
+    using Symbol = fluent::NamedType<fluent::InternedString, struct SymbolTag, fluent::Comparable, fluent::Hashable>;
+    static_assert(std::is_trivially_copyable<Symbol>::value, "copying an interned string is not trivial");
+    static_assert(sizeof(Symbol) == sizeof(void*), "an interned string is not a pointer");
+
+    auto const apple = Symbol("AAPL");
+    auto const otherApple = Symbol(std::string("AA") + "PL");
+    auto const google = Symbol("GOOG");
+    REQUIRE(apple == otherApple);
+    REQUIRE(apple.get().c_str() == otherApple.get().c_str());
+    REQUIRE(apple != google);
+    REQUIRE(apple < google);
+    REQUIRE(apple.get().view() == "AAPL");
+    REQUIRE(std::hash<Symbol>()(apple) == std::hash<Symbol>()(otherApple));
+
+    REQUIRE(Symbol("").get().empty());
+    REQUIRE(Symbol("") == Symbol(fluent::InternedString()));
+    REQUIRE(std::string_view(Symbol(fluent::InternedString()).get().c_str()).empty());
+
+    std::unordered_map<Symbol, int> positions;
+    positions[apple] = 1;
+    positions[otherApple] += 1;
+    REQUIRE(positions.size() == 1);
+    REQUIRE(positions[Symbol("AAPL")] == 2);
+}
+
+TEST_CASE("Interning strings from several threads")
+{
+    auto const countBefore = fluent::InternedString::interned_count();
+    std::vector<std::string> texts;
+    for (int i = 0; i < 100; ++i)
+    {
+        texts.push_back("symbol from threads " + std::to_string(i));
+    }
+
+    std::vector<std::vector<fluent::InternedString>> interned(4);
+    std::vector<std::thread> threads;
+    for (auto& result : interned)
+    {
+        threads.emplace_back([&texts, &result]() {
+            for (auto const& text : texts)
+            {
+                result.emplace_back(text);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (auto const& result : interned)
+    {
+        REQUIRE(result == interned.front());
+    }
+    REQUIRE(fluent::InternedString::interned_count() == countBefore + texts.size());
+}
+
+TEST_CASE("Instrumented skill compiles to nothing by default")
+{
+    using InstrumentedPrice = fluent::NamedType<int, struct InstrumentedPriceTag, fluent::Addable, fluent::Instrumented>;
+    static_assert(InstrumentedPrice::is_instrumented);
+    static_assert(sizeof(InstrumentedPrice) == sizeof(int));
+    static_assert(std::is_trivially_copyable<InstrumentedPrice>::value);
+
+    constexpr auto sum = InstrumentedPrice(1) + InstrumentedPrice(3);
+    static_assert(sum.get() == 4);
+
+    auto total = InstrumentedPrice(1);
+    total += InstrumentedPrice(2);
+    REQUIRE(total.get() == 3);
+    REQUIRE(fluent::instrumentation_snapshot().empty());
+    REQUIRE(fluent::instrumentation_counters{}.count(fluent::instrumented_event::binary_operation) == 0);
+}
+
+TEST_CASE("Identity elements of strong types")
+{
+    using Distance = fluent::NamedType<int, struct ParallelDistanceTag, fluent::Addable, fluent::Multiplicable, fluent::Comparable>;
+    static_assert(fluent::zero_of<Distance>().get() == 0);
+    static_assert(fluent::one_of<Distance>().get() == 1);
+    static_assert(fluent::identity<Distance, fluent::minimum>::value().get() == std::numeric_limits<int>::max());
+    static_assert(fluent::identity<Distance, fluent::maximum>::value().get() == std::numeric_limits<int>::lowest());
+
+    using Ratio = fluent::NamedType<double, struct ParallelRatioTag, fluent::Comparable>;
+    REQUIRE(std::isinf(fluent::identity<Ratio, fluent::minimum>::value().get()));
+    REQUIRE(fluent::identity<Ratio, fluent::maximum>::value().get() < 0);
+}
+
+TEST_CASE("Parallel reductions over strong types")
+{
+    using Distance = fluent::NamedType<long long, struct ParallelLengthTag, fluent::Addable, fluent::Multiplicable, fluent::Comparable>;
+    std::vector<Distance> distances;
+    for (long long i = 1; i <= 10000; ++i)
+    {
+        distances.emplace_back(i % 2 == 0 ? i : -i);
+    }
+
+    REQUIRE(fluent::par::sum(distances) == Distance(5000));
+    REQUIRE(fluent::par::sum(std::execution::seq, distances) == Distance(5000));
+    REQUIRE(fluent::par::min(distances) == Distance(-9999));
+    REQUIRE(fluent::par::max(std::execution::par, distances) == Distance(10000));
+
+    auto const factors = std::array<Distance, 4>{Distance(2), Distance(3), Distance(-1), Distance(7)};
+    REQUIRE(fluent::par::product(factors) == Distance(-42));
+    REQUIRE(fluent::batch::sum(distances) == fluent::par::sum(distances));
+    REQUIRE(fluent::batch::product(factors) == fluent::par::product(factors));
+
+    auto const empty = std::vector<Distance>();
+    REQUIRE(fluent::par::sum(empty) == fluent::zero_of<Distance>());
+    REQUIRE(fluent::par::product(empty) == fluent::one_of<Distance>());
+    REQUIRE(fluent::par::min(empty) == Distance(std::numeric_limits<long long>::max()));
+
+    auto const list = std::list<Distance>(distances.begin(), distances.end());
+    REQUIRE(fluent::par::sum(list) == Distance(5000));
+    REQUIRE(fluent::par::max(list) == Distance(10000));
+}
+
+TEST_CASE("Parallel inclusive scan over strong types")
+{
+    using Amount = fluent::NamedType<int, struct ParallelAmountTag, fluent::Addable, fluent::Comparable>;
+    auto const amounts = std::vector<Amount>{Amount(1), Amount(2), Amount(3), Amount(4)};
+
+    auto sums = std::vector<Amount>(amounts.size());
+    fluent::par::inclusive_scan(amounts, sums);
+    REQUIRE(sums == (std::vector<Amount>{Amount(1), Amount(3), Amount(6), Amount(10)}));
+
+    auto inPlace = amounts;
+    fluent::par::inclusive_scan(std::execution::seq, inPlace, inPlace);
+    REQUIRE(inPlace == sums);
+
+    auto const list = std::list<Amount>(amounts.begin(), amounts.end());
+    auto listSums = std::list<Amount>(amounts.size());
+    fluent::par::inclusive_scan(list, listSums);
+    REQUIRE(std::equal(listSums.begin(), listSums.end(), sums.begin()));
+}
+
+namespace
+{
+enum class Permission
+{
+    read,
+    write,
+    execute,
+    count
+};
+
+enum class Feature
+{
+    first = 0,
+    middle = 64,
+    last = 129,
+    count = 130
+};
+} // namespace
+
+TEST_CASE("Flags")
+{
+    using PermissionFlags = fluent::flags<Permission>;
+    static_assert(PermissionFlags::size() == 3);
+    static_assert(PermissionFlags::word_count == 1);
+
+    constexpr auto readWrite = PermissionFlags{Permission::read, Permission::write};
+    static_assert(readWrite.test(Permission::write));
+    static_assert(!readWrite.test(Permission::execute));
+    static_assert(readWrite.count() == 2);
+    static_assert((~readWrite).count() == 1);
+    static_assert((~readWrite).test(Permission::execute));
+    static_assert(PermissionFlags().none());
+    static_assert(PermissionFlags().set().all());
+    static_assert(!readWrite.all());
+
+    auto permissions = readWrite;
+    permissions.reset(Permission::read).flip(Permission::execute);
+    REQUIRE(permissions == (PermissionFlags{Permission::write, Permission::execute}));
+    REQUIRE(permissions.includes(PermissionFlags{Permission::write}));
+    REQUIRE(!permissions.includes(readWrite));
+    REQUIRE(permissions.intersects(readWrite));
+    REQUIRE(!permissions.intersects(PermissionFlags{Permission::read}));
+    REQUIRE((permissions & readWrite) == PermissionFlags{Permission::write});
+    REQUIRE((permissions | readWrite).all());
+    REQUIRE((permissions ^ readWrite) == (PermissionFlags{Permission::read, Permission::execute}));
+    REQUIRE(permissions.first() == Permission::write);
+    REQUIRE(!PermissionFlags().first().has_value());
+}
+
+TEST_CASE("Flags over several words")
+{
+    using FeatureFlags = fluent::flags<Feature>;
+    static_assert(FeatureFlags::word_count == 3);
+    static_assert(FeatureFlags().set().count() == 130);
+    static_assert((~FeatureFlags{Feature::middle}).count() == 129);
+
+    auto const features = FeatureFlags{Feature::last, Feature::first, Feature::middle};
+    std::vector<Feature> setFeatures(features.begin(), features.end());
+    REQUIRE(setFeatures == (std::vector<Feature>{Feature::first, Feature::middle, Feature::last}));
+    REQUIRE(std::distance(FeatureFlags().begin(), FeatureFlags().end()) == 0);
+    REQUIRE(FeatureFlags{Feature::last}.first() == Feature::last);
+    REQUIRE(features.words()[1] == 1);
+    REQUIRE(features.words()[2] == 2);
+}
+
+TEST_CASE("Flags up to the last one")
+{
+    using TwoPermissions = fluent::flags<Permission, 2>;
+    static_assert(TwoPermissions{Permission::write}.test(Permission::write));
+    static_assert(TwoPermissions().set().count() == 2);
+
+    auto permissions = TwoPermissions().set(Permission::write);
+    permissions.flip(Permission::write).set(Permission::read);
+    REQUIRE(permissions == TwoPermissions{Permission::read});
+    REQUIRE(permissions.words()[0] == 1);
+}
+
+TEST_CASE("Strong types over flags")
+{
+    using PermissionFlags = fluent::flags<Permission>;
+    using Permissions = fluent::NamedType<PermissionFlags, struct PermissionsTag, fluent::BitWiseAndable,
+                                          fluent::BitWiseOrable, fluent::Comparable, fluent::MethodCallable>;
+    auto const granted = Permissions(PermissionFlags{Permission::read, Permission::write});
+    auto const required = Permissions(PermissionFlags{Permission::write});
+    REQUIRE(granted->includes(required.get()));
+    REQUIRE((granted & required) == required);
+    REQUIRE((granted | Permissions(PermissionFlags{Permission::execute}))->all());
+
+    auto const users = std::vector<Permissions>{granted, required, Permissions(PermissionFlags{Permission::execute})};
+    auto const masks = std::vector<Permissions>(users.size(), Permissions(PermissionFlags{Permission::write, Permission::execute}));
+    auto restricted = users;
+    fluent::batch::bit_and(users, masks, restricted);
+    REQUIRE(restricted == (std::vector<Permissions>{required, required, Permissions(PermissionFlags{Permission::execute})}));
+    fluent::batch::bit_or(restricted, users, restricted);
+    REQUIRE(restricted == users);
+}
+
+TEST_CASE("ScalableBy")
+{
+    using Price = fluent::NamedType<double, struct ScalablePriceTag, fluent::Addable, fluent::Comparable,
+                                    fluent::Multiplicable, fluent::ScalableBy<double>::templ, fluent::ScalableBy<int>::templ>;
+    constexpr auto doubled = Price(1.5) * 2;
+    static_assert(doubled.get() > 2.9 && doubled.get() < 3.1);
+
+    auto price = Price(10.0);
+    REQUIRE((price * 0.5).get() == Approx(5.0));
+    REQUIRE((0.5 * price).get() == Approx(5.0));
+    REQUIRE((price / 4.0).get() == Approx(2.5));
+    REQUIRE((price * Price(2.0)).get() == Approx(20.0));
+    price *= 3;
+    price /= 2.0;
+    REQUIRE(price.get() == Approx(15.0));
+
+    static_assert(std::is_same<decltype(price * 0.5), Price>::value);
+    static_assert(!std::is_invocable<std::plus<>, Price, double>::value);
+}
+
+TEST_CASE("ShiftableBy")
+{
+    using Bitmask = fluent::NamedType<std::uint64_t, struct ShiftableBitmaskTag, fluent::BitWiseOrable, fluent::Comparable,
+                                      fluent::ShiftableBy<int>::templ>;
+    constexpr auto mask = Bitmask(1) << 4;
+    static_assert(mask.get() == 16);
+    static_assert((mask >> 2).get() == 4);
+
+    auto bits = Bitmask(3);
+    bits <<= 8;
+    REQUIRE(bits == Bitmask(0x300));
+    bits >>= 9;
+    REQUIRE(bits == Bitmask(1));
+    REQUIRE(((bits << 1) | bits) == Bitmask(3));
+    static_assert(!std::is_invocable<std::bit_or<>, Bitmask, int>::value);
+}
+
+TEST_CASE("OffsetBy")
+{
+    using Duration = fluent::NamedType<long long, struct OffsetDurationTag, fluent::Addable, fluent::Comparable>;
+    using TimePoint = fluent::NamedType<long long, struct OffsetTimePointTag, fluent::Comparable, fluent::OffsetBy<Duration>::templ>;
+    constexpr auto start = TimePoint(100);
+    constexpr auto end = start + Duration(50);
+    static_assert(end.get() == 150);
+    static_assert((end - start) == Duration(50));
+    static_assert((Duration(5) + start).get() == 105);
+    static_assert((end - Duration(10)).get() == 140);
+
+    auto now = start;
+    now += Duration(7);
+    now -= Duration(2);
+    REQUIRE(now == TimePoint(105));
+    static_assert(std::is_same<decltype(end - start), Duration>::value);
+    static_assert(!std::is_invocable<std::plus<>, TimePoint, TimePoint>::value);
+    static_assert(!std::is_invocable<std::plus<>, TimePoint, long long>::value);
+
+    using Address = fluent::NamedType<std::uintptr_t, struct OffsetAddressTag, fluent::Comparable, fluent::OffsetBy<std::uintptr_t>::templ>;
+    auto const base = Address(0x1000);
+    REQUIRE(base + std::uintptr_t(0x20) == Address(0x1020));
+    REQUIRE(Address(0x1020) - base == std::uintptr_t(0x20));
+}
+
+TEST_CASE("spsc_ring")
+{
+    using Timestamp = fluent::NamedType<std::uint64_t, struct RingTimestampTag, fluent::Comparable>;
+    REQUIRE_THROWS_AS(fluent::spsc_ring<Timestamp>(6), std::invalid_argument);
+
+    auto ring = fluent::spsc_ring<Timestamp>(4);
+    REQUIRE(ring.capacity() == 4);
+    REQUIRE(ring.empty());
+    REQUIRE(!ring.try_pop().has_value());
+
+    REQUIRE(ring.try_push(Timestamp(1)));
+    auto const batch = std::vector<Timestamp>{Timestamp(2), Timestamp(3), Timestamp(4), Timestamp(5)};
+    REQUIRE(ring.push(batch) == 3);
+    REQUIRE(!ring.try_push(Timestamp(6)));
+    REQUIRE(ring.size() == 4);
+
+    REQUIRE(ring.try_pop() == Timestamp(1));
+    REQUIRE(ring.try_pop() == Timestamp(2));
+    // The next batch wraps around the end of the storage.
+    REQUIRE(ring.push(std::span<Timestamp const>(batch).subspan(3)) == 1);
+    auto popped = std::vector<Timestamp>(batch);
+    REQUIRE(ring.pop(popped) == 3);
+    REQUIRE(popped[0] == Timestamp(3));
+    REQUIRE(popped[1] == Timestamp(4));
+    REQUIRE(popped[2] == Timestamp(5));
+    REQUIRE(ring.empty());
+}
+
+TEST_CASE("spsc_ring between two threads")
+{
+    using Sequence = fluent::NamedType<std::uint32_t, struct RingSequenceTag, fluent::Comparable>;
+    constexpr std::uint32_t count = 100000;
+    auto ring = fluent::spsc_ring<Sequence>(64);
+
+    std::thread producer([&ring]() noexcept {
+        for (std::uint32_t i = 0; i < count;)
+        {
+            auto const batch = std::array<Sequence, 3>{Sequence(i), Sequence(i + 1), Sequence(i + 2)};
+            auto const pushed = ring.push(std::span<Sequence const>(batch).first(std::min<std::size_t>(3, count - i)));
+            if (pushed == 0)
+            {
+                std::this_thread::yield();
+            }
+            i += static_cast<std::uint32_t>(pushed);
+        }
+    });
+
+    auto expected = std::uint32_t(0);
+    auto received = std::array<Sequence, 5>{};
+    bool inOrder = true;
+    while (expected < count)
+    {
+        auto const popped = ring.pop(received);
+        if (popped == 0)
+        {
+            std::this_thread::yield();
+        }
+        for (std::size_t i = 0; i < popped; ++i)
+        {
+            inOrder = inOrder && received[i] == Sequence(expected++);
+        }
+    }
+    producer.join();
+    REQUIRE(inOrder);
+    REQUIRE(ring.empty());
+}
+
+TEST_CASE("mpmc_queue between several threads")
+{
+    using OrderId = fluent::NamedType<std::uint32_t, struct QueueOrderIdTag, fluent::Comparable>;
+    REQUIRE_THROWS_AS(fluent::mpmc_queue<OrderId>(0), std::invalid_argument);
+
+    auto queue = fluent::mpmc_queue<OrderId>(2);
+    REQUIRE(queue.try_push(OrderId(1)));
+    REQUIRE(queue.try_push(OrderId(2)));
+    REQUIRE(!queue.try_push(OrderId(3)));
+    REQUIRE(queue.try_pop() == OrderId(1));
+    REQUIRE(queue.try_pop() == OrderId(2));
+    REQUIRE(!queue.try_pop().has_value());
+
+    constexpr std::uint32_t producers = 3;
+    constexpr std::uint32_t perProducer = 20000;
+    auto shared = fluent::mpmc_queue<OrderId>(128);
+    std::vector<std::thread> threads;
+    for (std::uint32_t producer = 0; producer < producers; ++producer)
+    {
+        threads.emplace_back([&shared, producer]() noexcept {
+            for (std::uint32_t i = 0; i < perProducer; ++i)
+            {
+                while (!shared.try_push(OrderId(producer * perProducer + i)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    std::vector<std::vector<std::uint32_t>> consumed(2);
+    std::atomic<std::uint32_t> remaining{producers * perProducer};
+    for (auto& ids : consumed)
+    {
+        threads.emplace_back([&shared, &ids, &remaining]() {
+            auto batch = std::array<OrderId, 8>{};
+            while (remaining.load() > 0)
+            {
+                auto const popped = shared.pop(batch);
+                if (popped == 0)
+                {
+                    std::this_thread::yield();
+                }
+                for (std::size_t i = 0; i < popped; ++i)
+                {
+                    ids.push_back(batch[i].get());
+                }
+                remaining -= static_cast<std::uint32_t>(popped);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto all = consumed[0];
+    all.insert(all.end(), consumed[1].begin(), consumed[1].end());
+    std::sort(all.begin(), all.end());
+    REQUIRE(all.size() == producers * perProducer);
+    REQUIRE(std::adjacent_find(all.begin(), all.end()) == all.end());
+    REQUIRE(all.back() == producers * perProducer - 1);
+}
+
+TEST_CASE("Strong durations")
+{
+    using namespace std::chrono_literals;
+    using LatencyNanos = fluent::strong_duration<struct ChronoLatencyTag, std::chrono::nanoseconds>;
+    using LatencyMicros = fluent::strong_duration<struct ChronoLatencyTag, std::chrono::microseconds>;
+
+    constexpr auto nanos = LatencyNanos(1500ns);
+    constexpr auto micros = LatencyMicros(2us);
+    static_assert(nanos < micros);
+    static_assert(micros > nanos);
+    static_assert(LatencyMicros(1us) == LatencyNanos(1000ns));
+    static_assert(std::is_same<decltype(nanos + micros), LatencyNanos>::value);
+    static_assert((nanos + micros) == LatencyNanos(3500ns));
+    static_assert((micros - nanos) == LatencyNanos(500ns));
+    static_assert((nanos * 2) == LatencyNanos(3000ns));
+    static_assert(fluent::duration_cast<LatencyMicros>(nanos) == LatencyMicros(1us));
+    static_assert(fluent::duration_cast<LatencyNanos>(micros).get().count() == 2000);
+
+    using OtherNanos = fluent::strong_duration<struct ChronoOtherTag, std::chrono::nanoseconds>;
+    static_assert(!std::is_invocable<std::plus<>, LatencyNanos, OtherNanos>::value);
+    static_assert(!std::is_invocable<std::less<>, LatencyMicros, OtherNanos>::value);
+}
+
+TEST_CASE("TSC conversion")
+{
+    constexpr auto threeGigahertz = fluent::tsc_conversion(3'000'000'000);
+    static_assert(threeGigahertz.to_nanoseconds(fluent::tsc_ticks(3'000'000'000)) == std::chrono::seconds(1));
+    static_assert(threeGigahertz.to_nanoseconds(fluent::tsc_ticks(3)) == std::chrono::nanoseconds(1));
+    static_assert(threeGigahertz.to_nanoseconds(fluent::tsc_ticks(31)) == std::chrono::nanoseconds(10));
+    // An hour of ticks does not overflow the intermediate product.
+    static_assert(threeGigahertz.to_nanoseconds(fluent::tsc_ticks(3'600ull * 3'000'000'000ull)) > std::chrono::minutes(59));
+    static_assert(fluent::tsc_conversion(1'000'000'000).to_nanoseconds(fluent::tsc_ticks(12345)) == std::chrono::nanoseconds(12345));
+    REQUIRE_THROWS_AS(fluent::tsc_conversion(0), std::invalid_argument);
+
+    auto const calibrated = fluent::tsc_conversion::calibrate(std::chrono::milliseconds(2));
+    REQUIRE(calibrated.ticks_per_second() > 0);
+    auto const start = fluent::read_tsc();
+    REQUIRE(fluent::read_tsc() >= start);
+}
+
+TEST_CASE("Stopwatch")
+{
+    using ElapsedTime = fluent::strong_duration<struct ChronoStopwatchTag, std::chrono::steady_clock::duration>;
+    auto watch = fluent::stopwatch<struct ChronoStopwatchTag>();
+    static_assert(std::is_same<decltype(watch.elapsed()), ElapsedTime>::value);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    auto const firstLap = watch.lap();
+    REQUIRE(firstLap >= ElapsedTime(std::chrono::milliseconds(1)));
+    REQUIRE(watch.elapsed() <= firstLap + watch.elapsed());
+    watch.restart();
+    REQUIRE(watch.elapsed() < ElapsedTime(std::chrono::hours(1)));
+}
+
+template <typename NamedType_, typename Value>
+concept ValidatedFrom = requires(Value value) { NamedType_::validated(value); };
+
+TEST_CASE("Validated strong types")
+{
+    using Percentage = fluent::NamedType<int, struct ValidatedPercentageTag, fluent::Addable, fluent::PreIncrementable,
+                                         fluent::Validated<fluent::in_range<0, 100>, fluent::validation::throw_if_invalid>::templ>;
+    using Volume = fluent::NamedType<unsigned, struct ValidatedVolumeTag, fluent::Addable, fluent::Subtractable,
+                                     fluent::Validated<fluent::in_range<0, 10>, fluent::validation::clamp_to_valid>::templ>;
+
+    REQUIRE(Percentage::validated(42).get() == 42);
+    REQUIRE_THROWS_AS(Percentage::validated(101), std::invalid_argument);
+    REQUIRE(Percentage(fluent::unchecked, 150).get() == 150);
+    REQUIRE(Volume::validated(25u).get() == 10u);
+    static_assert(ValidatedFrom<Percentage, int>);
+    static_assert(!ValidatedFrom<Percentage, double>);
+    static_assert(fluent::in_range<-1, 1>()(0u));
+    static_assert(!fluent::in_range<0, 10>()(-1));
+    static_assert(noexcept(Volume(3u)));
+    static_assert(std::is_nothrow_constructible<Percentage, int>::value == !FLUENT_VALIDATE);
+
+#if FLUENT_VALIDATE
+    REQUIRE_THROWS_AS(Percentage(-1), std::invalid_argument);
+    auto percentage = Percentage(99);
+    ++percentage;
+    REQUIRE_THROWS_AS(++percentage, std::invalid_argument);
+    REQUIRE_THROWS_AS(percentage += Percentage(1), std::invalid_argument);
+
+    auto volume = Volume(12u);
+    REQUIRE(volume.get() == 10u);
+    volume += Volume(5u);
+    REQUIRE(volume.get() == 10u);
+    volume -= Volume(4u);
+    REQUIRE(volume.get() == 6u);
+#endif
+}
+
+TEST_CASE("Validated strong types read from text or bytes")
+{
+    using Percentage = fluent::NamedType<int, struct ReadPercentageTag, fluent::Parsable, fluent::Serializable,
+                                         fluent::Validated<fluent::in_range<0, 100>, fluent::validation::throw_if_invalid>::templ>;
+    using Volume = fluent::NamedType<unsigned, struct ReadVolumeTag, fluent::Parsable,
+                                     fluent::Validated<fluent::in_range<0, 10>, fluent::validation::clamp_to_valid>::templ>;
+    using RawPercentage = fluent::NamedType<int, struct RawPercentageTag, fluent::Serializable>;
+
+    auto percentage = Percentage(fluent::unchecked, 7);
+    std::string_view const valid = "42";
+    REQUIRE(percentage.from_chars(valid.data(), valid.data() + valid.size()).ec == std::errc{});
+    REQUIRE(percentage.get() == 42);
+    std::string_view const outOfRange = "150";
+    REQUIRE_THROWS_AS(percentage.from_chars(outOfRange.data(), outOfRange.data() + outOfRange.size()), std::invalid_argument);
+    REQUIRE(percentage.get() == 42);
+    static_assert(!noexcept(percentage.from_chars(valid.data(), valid.data())));
+
+    auto volume = Volume(fluent::unchecked, 0u);
+    std::string_view const loud = "25";
+    REQUIRE(volume.from_chars(loud.data(), loud.data() + loud.size()).ec == std::errc{});
+    REQUIRE(volume.get() == 10u);
+    static_assert(noexcept(volume.from_chars(loud.data(), loud.data())));
+
+    std::byte bytes[2 * sizeof(int)];
+    fluent::serialize<std::endian::little>(std::vector<RawPercentage>{RawPercentage(42), RawPercentage(150)}, bytes);
+    REQUIRE((fluent::deserialize<Percentage, std::endian::little>(bytes).get() == 42));
+    REQUIRE_THROWS_AS((fluent::deserialize<Percentage, std::endian::little>(std::span<std::byte const>(bytes).subspan(sizeof(int)))),
+                      std::invalid_argument);
+    auto percentages = std::vector<Percentage>(2, Percentage(fluent::unchecked, 0));
+    REQUIRE_THROWS_AS(fluent::deserialize<std::endian::little>(bytes, percentages), std::invalid_argument);
+    REQUIRE(percentages[0].get() == 42);
+    REQUIRE(percentages[1].get() == 0);
+}